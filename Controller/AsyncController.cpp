@@ -0,0 +1,204 @@
+// AsyncController.cpp
+#include "AsyncController.h"
+#include <QDebug>
+
+AsyncController::AsyncController(std::unique_ptr<Controller> controller)
+    : m_controller(std::move(controller)),
+      m_queueDepth(MetricsRegistry::instance().gauge("async_controller.queue_depth")) {
+    // A single thread that never expires keeps writes ordered and on one thread for the session
+    m_executor.setMaxThreadCount(1);
+    m_executor.setExpiryTimeout(-1);
+    if (m_controller) {
+        m_controller->setSnapshotReads(true);
+    } else {
+        qWarning() << "Controller not available. Async operations will do nothing.";
+    }
+}
+
+AsyncController::~AsyncController() {
+    m_executor.waitForDone();
+    qDebug() << "AsyncController destroyed.";
+}
+
+// --- Volunteer Management ---
+
+QFuture<void> AsyncController::addVolunteer(Volunteer volunteer) {
+    return enqueue([volunteer = std::move(volunteer)](Controller& controller) mutable {
+        controller.addVolunteer(std::move(volunteer));
+    });
+}
+
+QFuture<int> AsyncController::addVolunteer(QString name, QString contactInfo) {
+    return enqueue([name = std::move(name), contactInfo = std::move(contactInfo)](Controller& controller) mutable {
+        return controller.addVolunteer(std::move(name), std::move(contactInfo));
+    });
+}
+
+QFuture<void> AsyncController::removeVolunteer(int id) {
+    return enqueue([id](Controller& controller) { controller.removeVolunteer(id); });
+}
+
+QFuture<void> AsyncController::updateVolunteer(int oldId, Volunteer newVolunteer) {
+    return enqueue([oldId, newVolunteer = std::move(newVolunteer)](Controller& controller) mutable {
+        controller.updateVolunteer(oldId, std::move(newVolunteer));
+    });
+}
+
+QFuture<std::vector<Volunteer>> AsyncController::getAllVolunteers() {
+    return enqueue([](Controller& controller) { return controller.getAllVolunteers(); });
+}
+
+QFuture<QueryPage<Volunteer>> AsyncController::queryVolunteers(VolunteerFilter filter, VolunteerSortKey sortKey,
+                                                               int offset, int limit, SortOrder order) {
+    return enqueue([filter = std::move(filter), sortKey, offset, limit, order](Controller& controller) {
+        return controller.queryVolunteers(filter, sortKey, offset, limit, order);
+    });
+}
+
+QFuture<ImportResult> AsyncController::importVolunteers(std::vector<Volunteer> volunteers, ImportIds ids) {
+    return enqueue([volunteers = std::move(volunteers), ids](Controller& controller) {
+        return controller.importVolunteers(volunteers, ids);
+    });
+}
+
+QFuture<ImportResult> AsyncController::importVolunteers(QString filename) {
+    return enqueue([filename = std::move(filename)](Controller& controller) {
+        return controller.importVolunteers(filename);
+    });
+}
+
+// --- Event Management ---
+
+QFuture<void> AsyncController::addEvent(Event event) {
+    return enqueue([event = std::move(event)](Controller& controller) mutable {
+        controller.addEvent(std::move(event));
+    });
+}
+
+QFuture<int> AsyncController::addEvent(QString title, QDate date, QString location) {
+    return enqueue([title = std::move(title), date, location = std::move(location)](Controller& controller) mutable {
+        return controller.addEvent(std::move(title), date, std::move(location));
+    });
+}
+
+QFuture<void> AsyncController::removeEvent(int id) {
+    return enqueue([id](Controller& controller) { controller.removeEvent(id); });
+}
+
+QFuture<void> AsyncController::updateEvent(int oldId, Event newEvent) {
+    return enqueue([oldId, newEvent = std::move(newEvent)](Controller& controller) mutable {
+        controller.updateEvent(oldId, std::move(newEvent));
+    });
+}
+
+QFuture<void> AsyncController::updateEventFields(int id, EventFields fields, EventFieldValues values) {
+    return enqueue([id, fields, values = std::move(values)](Controller& controller) mutable {
+        controller.updateEventFields(id, fields, std::move(values));
+    });
+}
+
+QFuture<std::vector<Event>> AsyncController::getAllEvents() {
+    return enqueue([](Controller& controller) { return controller.getAllEvents(); });
+}
+
+QFuture<QueryPage<Event>> AsyncController::queryEvents(EventFilter filter, EventSortKey sortKey,
+                                                       int offset, int limit, SortOrder order) {
+    return enqueue([filter = std::move(filter), sortKey, offset, limit, order](Controller& controller) {
+        return controller.queryEvents(filter, sortKey, offset, limit, order);
+    });
+}
+
+QFuture<ImportResult> AsyncController::importEvents(std::vector<Event> events, ImportIds ids) {
+    return enqueue([events = std::move(events), ids](Controller& controller) {
+        return controller.importEvents(events, ids);
+    });
+}
+
+QFuture<ImportResult> AsyncController::importEvents(QString filename) {
+    return enqueue([filename = std::move(filename)](Controller& controller) {
+        return controller.importEvents(filename);
+    });
+}
+
+// --- Volunteer-Event Association ---
+
+QFuture<bool> AsyncController::addVolunteerToEvent(int volunteerId, int eventId) {
+    return enqueue([volunteerId, eventId](Controller& controller) {
+        return controller.addVolunteerToEvent(volunteerId, eventId);
+    });
+}
+
+QFuture<void> AsyncController::removeVolunteerFromEvent(int volunteerId, int eventId) {
+    return enqueue([volunteerId, eventId](Controller& controller) {
+        controller.removeVolunteerFromEvent(volunteerId, eventId);
+    });
+}
+
+QFuture<std::vector<BookingConflict>> AsyncController::findBookingConflicts() {
+    return enqueue([](Controller& controller) { return controller.findBookingConflicts(); });
+}
+
+// --- Undo/Redo ---
+
+QFuture<void> AsyncController::undo() {
+    return enqueue([](Controller& controller) { controller.undo(); });
+}
+
+QFuture<void> AsyncController::redo() {
+    return enqueue([](Controller& controller) { controller.redo(); });
+}
+
+// --- Queries ---
+
+QFuture<std::vector<Event>> AsyncController::filterEventsByDate(QString dateFilter) {
+    return enqueue([dateFilter = std::move(dateFilter)](Controller& controller) {
+        return controller.filterEventsByDate(dateFilter);
+    });
+}
+
+QFuture<std::vector<Event>> AsyncController::filterEventsByLocation(QString locationFilter) {
+    return enqueue([locationFilter = std::move(locationFilter)](Controller& controller) {
+        return controller.filterEventsByLocation(locationFilter);
+    });
+}
+
+QFuture<std::shared_ptr<const std::vector<int>>> AsyncController::matchingEventIds(EventFilter filter) {
+    return enqueue([filter = std::move(filter)](Controller& controller) {
+        return controller.matchingEventIds(filter);
+    });
+}
+
+QFuture<std::vector<Event>> AsyncController::upcomingEvents(QDate from, int n) {
+    return enqueue([from, n](Controller& controller) { return controller.upcomingEvents(from, n); });
+}
+
+QFuture<qint64> AsyncController::exportEventReport(QString filename, ExportOptions options) {
+    QFuture<std::shared_ptr<const ControllerSnapshot>> taken = enqueue([](Controller& controller) {
+        return controller.snapshot();
+    });
+    return taken.then(QThreadPool::globalInstance(),
+                      [filename = std::move(filename), options](std::shared_ptr<const ControllerSnapshot> published) -> qint64 {
+        if (!published) {
+            qWarning() << "Snapshot not available. Cannot export event report.";
+            return -1;
+        }
+        ReportExporter exporter(published->volunteers, published->events);
+        return exporter.exportEvents(filename, options);
+    });
+}
+
+QFuture<void> AsyncController::flush() {
+    return enqueue([](Controller&) {});
+}
+
+int AsyncController::pendingOperations() const {
+    return m_pending.load(std::memory_order_relaxed);
+}
+
+std::shared_ptr<const ControllerSnapshot> AsyncController::snapshot() const {
+    return m_controller ? m_controller->snapshot() : nullptr;
+}
+
+ChangeNotifier* AsyncController::changeNotifier() {
+    return m_controller ? m_controller->changeNotifier() : nullptr;
+}
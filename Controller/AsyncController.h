@@ -0,0 +1,103 @@
+// AsyncController.h
+#ifndef ASYNCCONTROLLER_H
+#define ASYNCCONTROLLER_H
+
+#include <QFuture>
+#include <QThreadPool>
+#include <QtConcurrent/QtConcurrent>
+#include <atomic>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include "Controller.h"
+#include "../core/Metrics/Metrics.h"
+
+// Asynchronous facade over a Controller. Every call is queued on one dedicated executor thread and
+// returns at once with a QFuture for its result. Operations run one at a time in the order they were
+// queued, so a query sees every write queued before it and undo/redo act on the same history as the
+// synchronous API. Callers may queue from any thread without waiting on one another.
+//
+// The facade owns the controller: nothing else may call it directly. Readers that need no ordering
+// take snapshot(), which never waits for the queue.
+class AsyncController {
+public:
+    explicit AsyncController(std::unique_ptr<Controller> controller);
+    // Waits for every queued operation before the controller is destroyed
+    ~AsyncController();
+
+    QFuture<void> addVolunteer(Volunteer volunteer);
+    QFuture<int> addVolunteer(QString name, QString contactInfo);
+    QFuture<void> removeVolunteer(int id);
+    QFuture<void> updateVolunteer(int oldId, Volunteer newVolunteer);
+    QFuture<std::vector<Volunteer>> getAllVolunteers();
+    QFuture<QueryPage<Volunteer>> queryVolunteers(VolunteerFilter filter, VolunteerSortKey sortKey, int offset, int limit,
+                                                  SortOrder order = SortOrder::Ascending);
+    QFuture<ImportResult> importVolunteers(std::vector<Volunteer> volunteers, ImportIds ids = ImportIds::Keep);
+    QFuture<ImportResult> importVolunteers(QString filename);
+
+    QFuture<void> addEvent(Event event);
+    QFuture<int> addEvent(QString title, QDate date, QString location);
+    QFuture<void> removeEvent(int id);
+    QFuture<void> updateEvent(int oldId, Event newEvent);
+    QFuture<void> updateEventFields(int id, EventFields fields, EventFieldValues values);
+    QFuture<std::vector<Event>> getAllEvents();
+    QFuture<QueryPage<Event>> queryEvents(EventFilter filter, EventSortKey sortKey, int offset, int limit,
+                                          SortOrder order = SortOrder::Ascending);
+    QFuture<ImportResult> importEvents(std::vector<Event> events, ImportIds ids = ImportIds::Keep);
+    QFuture<ImportResult> importEvents(QString filename);
+
+    QFuture<bool> addVolunteerToEvent(int volunteerId, int eventId);
+    QFuture<void> removeVolunteerFromEvent(int volunteerId, int eventId);
+    QFuture<std::vector<BookingConflict>> findBookingConflicts();
+
+    QFuture<void> undo();
+    QFuture<void> redo();
+
+    QFuture<std::vector<Event>> filterEventsByDate(QString dateFilter);
+    QFuture<std::vector<Event>> filterEventsByLocation(QString locationFilter);
+    QFuture<std::shared_ptr<const std::vector<int>>> matchingEventIds(EventFilter filter);
+    QFuture<std::vector<Event>> upcomingEvents(QDate from, int n);
+
+    // The snapshot is taken in queue order, then the export runs on the global pool so later
+    // operations do not wait for it
+    QFuture<qint64> exportEventReport(QString filename, ExportOptions options = ExportOptions());
+
+    // Finishes once every operation queued before it has run
+    QFuture<void> flush();
+    // Operations queued but not yet finished
+    int pendingOperations() const;
+
+    // Thread-safe passthroughs: the latest published version, and the change signals (emitted on the
+    // executor thread, so receivers on other threads get them queued)
+    std::shared_ptr<const ControllerSnapshot> snapshot() const;
+    ChangeNotifier* changeNotifier();
+
+private:
+    // Runs operation(controller) on the executor after everything queued before it
+    template <typename Operation>
+    auto enqueue(Operation operation) {
+        m_queueDepth.set(m_pending.fetch_add(1, std::memory_order_relaxed) + 1);
+        return QtConcurrent::run(&m_executor, [this, operation = std::move(operation)]() mutable {
+            struct Done {
+                AsyncController* self;
+                ~Done() { self->m_queueDepth.set(self->m_pending.fetch_sub(1, std::memory_order_relaxed) - 1); }
+            } done{this};
+            using Result = std::invoke_result_t<Operation&, Controller&>;
+            if (!m_controller) {
+                if constexpr (std::is_void_v<Result>) {
+                    return;
+                } else {
+                    return Result{};
+                }
+            }
+            return operation(*m_controller);
+        });
+    }
+
+    std::unique_ptr<Controller> m_controller;
+    std::atomic<int> m_pending{0};
+    Gauge& m_queueDepth;
+    QThreadPool m_executor; // One thread, FIFO; destroyed first
+};
+
+#endif // ASYNCCONTROLLER_H
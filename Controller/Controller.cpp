@@ -1,7 +1,10 @@
 // Controller.cpp
 #include "Controller.h"
 #include <QDebug>
+#include <QStringList>
 #include <algorithm>
+#include "../core/Trace/Trace.h"
+#include "../core/Replay/OperationLog.h"
 
 #include "../core/Command/AddVolunteerCommand.h"
 #include "../core/Command/RemoveVolunteerCommand.h"
@@ -10,50 +13,123 @@
 #include "../core/Command/AddEventCommand.h"
 #include "../core/Command/RemoveEventCommand.h"
 #include "../core/Command/UpdateEventCommand.h"
+#include "../core/Command/PatchEventCommand.h"
+
+#include "../core/Command/ImportVolunteersCommand.h"
+#include "../core/Command/ImportEventsCommand.h"
+
+namespace {
+
+// Volunteers that take a new (volunteer, day) slot when before becomes an event on date with volunteerIds
+QList<int> joiningVolunteers(const Event& before, const QDate& date, const QList<int>& volunteerIds) {
+    if (before.getDate() != date) {
+        return volunteerIds;
+    }
+    QList<int> joining;
+    const QList<int> previous = before.getVolunteerIds();
+    for (int volunteerId : volunteerIds) {
+        if (!previous.contains(volunteerId)) {
+            joining.append(volunteerId);
+        }
+    }
+    return joining;
+}
+
+// "<label> 1, 2" for a non-empty list, else empty
+QString describeEvents(const QString& label, const QList<int>& eventIds) {
+    if (eventIds.isEmpty()) {
+        return QString();
+    }
+    QStringList ids;
+    for (int eventId : eventIds) {
+        ids.append(QString::number(eventId));
+    }
+    return label + ' ' + ids.join(", ");
+}
+
+} // namespace
 
 Controller::Controller(std::unique_ptr<BaseRepository<Volunteer>> volunteerRepo,
                        std::unique_ptr<BaseRepository<Event>> eventRepo)
-    : m_volunteerRepo(std::move(volunteerRepo)), m_eventRepo(std::move(eventRepo)) {
+    : m_volunteerRepo(std::move(volunteerRepo)), m_eventRepo(std::move(eventRepo)),
+      m_volunteerNameKeys([](const Volunteer& v) { return v.getName(); }),
+      m_eventTitleKeys([](const Event& e) { return e.getTitle(); }, static_cast<std::uint32_t>(EventField::Title)) {
     if (!m_volunteerRepo) {
         qWarning() << "Volunteer Repository not available.";
+    } else {
+        m_volunteerRepo->addObserver(&m_volunteerNameKeys);
+        m_volunteerRepo->addObserver(&m_changeNotifier);
     }
     if (!m_eventRepo) {
         qWarning() << "Event Repository not available.";
+    } else {
+        m_eventRepo->addObserver(&m_eventTitleKeys);
+        m_eventRepo->addObserver(&m_eventDateIndex);
+        m_eventAggregates.rebuild(*m_eventRepo);
+        m_eventRepo->addObserver(&m_eventAggregates);
+        m_bookingIndex.rebuild(*m_eventRepo);
+        m_eventRepo->addObserver(&m_bookingIndex);
+        m_eventRepo->addObserver(&m_changeNotifier);
     }
 
 }
 
 Controller::~Controller() {
+    // The final dump samples memoryUsage(), so it must run while every member it reads is alive
+    m_metricsDumper.reset();
     qDebug() << "Controller destroyed.";
 }
 
 // --- Volunteer Management Implementations ---
 
 void Controller::addVolunteer(const Volunteer& volunteer) {
+    addVolunteer(Volunteer(volunteer));
+}
+
+void Controller::addVolunteer(Volunteer&& volunteer) {
+    METRIC_LATENCY("controller.add_volunteer");
+    TRACE_SCOPE("controller", "Controller::addVolunteer");
+    if (m_recorder) {
+        m_recorder->record(RecordedOperation::forVolunteer(OperationType::AddVolunteer, volunteer.getId(), volunteer));
+    }
     if (m_volunteerRepo) {
-        std::unique_ptr<Command> command = std::make_unique<AddVolunteerCommand>(m_volunteerRepo.get(), volunteer);
+        qDebug() << "Volunteer added:" << volunteer.getName();
+        std::unique_ptr<Command> command = std::make_unique<AddVolunteerCommand>(m_volunteerRepo.get(), m_eventRepo.get(), &m_bookingIndex, std::move(volunteer));
         command->execute();
+        publishSnapshot();
         m_undoStack.push(std::move(command));
         // m_redoStack.clear();
         while (!m_redoStack.empty()) {
             m_redoStack.pop();
         }
-        qDebug() << "Volunteer added:" << volunteer.getName();
     } else {
         qWarning() << "Volunteer Repository not available. Cannot add volunteer.";
     }
 }
 
+int Controller::addVolunteer(QString name, QString contactInfo) {
+    if (!m_volunteerRepo) {
+        qWarning() << "Volunteer Repository not available. Cannot add volunteer.";
+        return -1;
+    }
+    const int id = m_volunteerRepo->nextId();
+    addVolunteer(Volunteer(id, std::move(name), std::move(contactInfo)));
+    return id;
+}
+
 void Controller::removeVolunteer(int id) {
+    METRIC_LATENCY("controller.remove_volunteer");
+    TRACE_SCOPE("controller", "Controller::removeVolunteer");
+    if (m_recorder) {
+        m_recorder->record({.type = OperationType::RemoveVolunteer, .id = id});
+    }
     if (m_volunteerRepo) {
-        std::vector<Volunteer> volunteers = m_volunteerRepo->getAll();
-        auto it =
-            std::find_if(volunteers.begin(), volunteers.end(), [id](const Volunteer& v) {return v.getId() == id;});
+        const Volunteer* existing = m_volunteerRepo->findById(id);
 
-        if (it != volunteers.end()) {
-            Volunteer oldVolunteer = *it;
-            std::unique_ptr<Command> command = std::make_unique<RemoveVolunteerCommand>(m_volunteerRepo.get(), oldVolunteer);
+        if (existing) {
+            std::unique_ptr<Command> command = std::make_unique<RemoveVolunteerCommand>(m_volunteerRepo.get(), m_eventRepo.get(), &m_bookingIndex, id);
             command->execute();
+            publishSnapshot();
             m_undoStack.push(std::move(command));
 
             while (!m_redoStack.empty()) {
@@ -70,20 +146,27 @@ void Controller::removeVolunteer(int id) {
 }
 
 void Controller::updateVolunteer(int oldId, const Volunteer& newVolunteer) {
+    updateVolunteer(oldId, Volunteer(newVolunteer));
+}
+
+void Controller::updateVolunteer(int oldId, Volunteer&& newVolunteer) {
+    METRIC_LATENCY("controller.update_volunteer");
+    TRACE_SCOPE("controller", "Controller::updateVolunteer");
+    if (m_recorder) {
+        m_recorder->record(RecordedOperation::forVolunteer(OperationType::UpdateVolunteer, oldId, newVolunteer));
+    }
     if (m_volunteerRepo) {
-        std::vector<Volunteer> allVolunteers = m_volunteerRepo->getAll();
-        auto it = std::find_if(allVolunteers.begin(), allVolunteers.end(), [oldId](const Volunteer& v) { return v.getId() == oldId; });
-        if (it != allVolunteers.end()) {
-            Volunteer oldVolunteer = *it;
-            std::unique_ptr<Command> command = std::make_unique<UpdateVolunteerCommand>(m_volunteerRepo.get(), oldVolunteer, newVolunteer);
+        const Volunteer* existing = m_volunteerRepo->findById(oldId);
+        if (existing) {
+            qDebug() << "Volunteer updated:" << newVolunteer.getName();
+            std::unique_ptr<Command> command = std::make_unique<UpdateVolunteerCommand>(m_volunteerRepo.get(), std::move(newVolunteer));
             command->execute();
+            publishSnapshot();
             m_undoStack.push(std::move(command));
 
             while (!m_redoStack.empty()) {
                 m_redoStack.pop();
             }
-
-            qDebug() << "Volunteer updated:" << newVolunteer.getName();
         } else {
             qWarning() << "Volunteer with ID " << oldId << " not found.";
         }
@@ -102,32 +185,159 @@ std::vector<Volunteer> Controller::getAllVolunteers() const {
     }
 }
 
+QueryPage<Volunteer> Controller::queryVolunteers(const VolunteerFilter& filter, VolunteerSortKey sortKey,
+                                                 int offset, int limit, SortOrder order) const {
+    METRIC_LATENCY("controller.query_volunteers");
+    TRACE_SCOPE("controller", "Controller::queryVolunteers");
+    QueryPage<Volunteer> page;
+    if (!m_volunteerRepo) {
+        qWarning() << "Volunteer Repository not available. Cannot query volunteers.";
+        return page;
+    }
+
+    if (sortKey == VolunteerSortKey::Name && !m_volunteerNameKeys.isBuilt()) {
+        m_volunteerNameKeys.build(*m_volunteerRepo);
+    }
+
+    // Collect pointers into the repository storage; only the page itself is copied
+    std::vector<SortCandidate<Volunteer>> candidates;
+    m_volunteerRepo->forEach([&](const Volunteer& volunteer) {
+        if (filter.matches(volunteer)) {
+            const QCollatorSortKey* key = sortKey == VolunteerSortKey::Name ? m_volunteerNameKeys.find(volunteer.getId()) : nullptr;
+            candidates.push_back({&volunteer, key});
+        }
+    });
+    page.total = static_cast<int>(candidates.size());
+
+    auto less = [sortKey](const SortCandidate<Volunteer>& a, const SortCandidate<Volunteer>& b) {
+        int cmp = 0;
+        switch (sortKey) {
+        case VolunteerSortKey::Id:
+            break;
+        case VolunteerSortKey::Name:
+            cmp = a.key->compare(*b.key);
+            break;
+        case VolunteerSortKey::ContactInfo:
+            cmp = QString::compare(a.item->getContactInfo(), b.item->getContactInfo(), Qt::CaseInsensitive);
+            break;
+        }
+        return cmp != 0 ? cmp < 0 : a.item->getId() < b.item->getId();
+    };
+    page.items = selectPage(candidates, offset, limit, order, less);
+    return page;
+}
+
+ImportResult Controller::importVolunteers(const std::vector<Volunteer>& volunteers, ImportIds ids) {
+    METRIC_LATENCY("controller.import_volunteers");
+    TRACE_SCOPE("controller", "Controller::importVolunteers");
+    if (m_recorder) {
+        m_recorder->record(RecordedOperation::forImport(static_cast<int>(ids), volunteers));
+    }
+    ImportResult result;
+    if (!m_volunteerRepo) {
+        qWarning() << "Volunteer Repository not available. Cannot import volunteers.";
+        return result;
+    }
+
+    QSet<int> existingIds;
+    std::vector<Volunteer> renumbered;
+    if (ids == ImportIds::Assign) {
+        // Validated under row numbers; only accepted rows take a repository ID, so rejects use none up
+        renumbered.reserve(volunteers.size());
+        for (std::size_t row = 0; row < volunteers.size(); ++row) {
+            renumbered.emplace_back(static_cast<int>(row) + 1, volunteers[row].getName(), volunteers[row].getContactInfo());
+        }
+    } else {
+        for (const auto& volunteer : m_volunteerRepo->getAll()) {
+            existingIds.insert(volunteer.getId());
+        }
+    }
+    const std::vector<Volunteer>& rows = ids == ImportIds::Assign ? renumbered : volunteers;
+
+    const std::size_t firstIssue = result.issues.size();
+    std::vector<Volunteer> accepted = BulkImporter::validateVolunteers(rows, existingIds, result.issues);
+    if (ids == ImportIds::Assign) {
+        for (std::size_t i = firstIssue; i < result.issues.size(); ++i) {
+            result.issues[i].id = volunteers[result.issues[i].id - 1].getId(); // Report the row's own ID
+        }
+        for (Volunteer& volunteer : accepted) {
+            volunteer = Volunteer(m_volunteerRepo->nextId(), volunteer.getName(), volunteer.getContactInfo());
+        }
+    }
+    if (!accepted.empty()) {
+        // The whole import is a single command, so one undo reverts it
+        result.imported = static_cast<int>(accepted.size());
+        std::unique_ptr<Command> command = std::make_unique<ImportVolunteersCommand>(m_volunteerRepo.get(), m_eventRepo.get(), &m_bookingIndex, accepted);
+        command->execute();
+        publishSnapshot();
+        m_undoStack.push(std::move(command));
+
+        while (!m_redoStack.empty()) {
+            m_redoStack.pop();
+        }
+    }
+
+    qDebug() << "Imported" << result.imported << "volunteers," << result.issues.size() << "rejected.";
+    return result;
+}
+
+ImportResult Controller::importVolunteers(const QString& filename) {
+    std::vector<ImportIssue> parseIssues;
+    std::vector<Volunteer> volunteers = BulkImporter::readVolunteers(filename, parseIssues);
+    ImportResult result = importVolunteers(volunteers);
+    result.issues.insert(result.issues.begin(), parseIssues.begin(), parseIssues.end());
+    return result;
+}
+
 // --- Event Management Implementations ---
 
 void Controller::addEvent(const Event& event) {
+    addEvent(Event(event));
+}
+
+void Controller::addEvent(Event&& event) {
+    METRIC_LATENCY("controller.add_event");
+    TRACE_SCOPE("controller", "Controller::addEvent");
+    if (m_recorder) {
+        m_recorder->record(RecordedOperation::forEvent(OperationType::AddEvent, event.getId(), event));
+    }
     if (m_eventRepo) {
-        std::unique_ptr<Command> command = std::make_unique<AddEventCommand>(m_eventRepo.get(), event);
+        qDebug() << "Event added:" << event.getTitle();
+        std::unique_ptr<Command> command = std::make_unique<AddEventCommand>(m_eventRepo.get(), std::move(event));
         command->execute();
+        publishSnapshot();
         m_undoStack.push(std::move(command));
 
         while (!m_redoStack.empty()) {
             m_redoStack.pop();
         }
-
-        qDebug() << "Event added:" << event.getTitle();
     } else {
         qWarning() << "Event Repository not available. Cannot add event.";
     }
 }
 
+int Controller::addEvent(QString title, QDate date, QString location) {
+    if (!m_eventRepo) {
+        qWarning() << "Event Repository not available. Cannot add event.";
+        return -1;
+    }
+    const int id = m_eventRepo->nextId();
+    addEvent(Event(id, std::move(title), date, std::move(location)));
+    return id;
+}
+
 void Controller::removeEvent(int id) {
+    METRIC_LATENCY("controller.remove_event");
+    TRACE_SCOPE("controller", "Controller::removeEvent");
+    if (m_recorder) {
+        m_recorder->record({.type = OperationType::RemoveEvent, .id = id});
+    }
     if (m_eventRepo) {
-        std::vector<Event> allEvents = m_eventRepo->getAll();
-        auto it = std::find_if(allEvents.begin(), allEvents.end(), [id](const Event& e) { return e.getId() == id; });
-        if (it != allEvents.end()) {
-            Event oldEvent = *it;
-            std::unique_ptr<Command> command = std::make_unique<RemoveEventCommand>(m_eventRepo.get(), oldEvent);
+        const Event* existing = m_eventRepo->findById(id);
+        if (existing) {
+            std::unique_ptr<Command> command = std::make_unique<RemoveEventCommand>(m_eventRepo.get(), id);
             command->execute();
+            publishSnapshot();
             m_undoStack.push(std::move(command));
 
             while (!m_redoStack.empty()) {
@@ -144,20 +354,32 @@ void Controller::removeEvent(int id) {
 }
 
 void Controller::updateEvent(int oldId, const Event& newEvent) {
+    updateEvent(oldId, Event(newEvent));
+}
+
+void Controller::updateEvent(int oldId, Event&& newEvent) {
+    METRIC_LATENCY("controller.update_event");
+    TRACE_SCOPE("controller", "Controller::updateEvent");
+    if (m_recorder) {
+        m_recorder->record(RecordedOperation::forEvent(OperationType::UpdateEvent, oldId, newEvent));
+    }
     if (m_eventRepo) {
-        std::vector<Event> allEvents = m_eventRepo->getAll();
-        auto it = std::find_if(allEvents.begin(), allEvents.end(), [oldId](const Event& e) { return e.getId() == oldId; });
-        if (it != allEvents.end()) {
-            Event oldEvent = *it;
-            std::unique_ptr<Command> command = std::make_unique<UpdateEventCommand>(m_eventRepo.get(), oldEvent, newEvent);
+        const Event* existing = m_eventRepo->findById(oldId);
+        if (existing) {
+            const QList<int> joining = joiningVolunteers(*existing, newEvent.getDate(), newEvent.getVolunteerIds());
+            if (!admitsDoubleBooking(oldId, newEvent.getDate(),
+                                     describeEvents("events", bookingConflicts(joining, newEvent.getDate(), oldId)))) {
+                return;
+            }
+            qDebug() << "Event updated:" << newEvent.getTitle();
+            std::unique_ptr<Command> command = std::make_unique<UpdateEventCommand>(m_eventRepo.get(), std::move(newEvent));
             command->execute();
+            publishSnapshot();
             m_undoStack.push(std::move(command));
 
             while (!m_redoStack.empty()) {
                 m_redoStack.pop();
             }
-
-            qDebug() << "Event updated:" << newEvent.getTitle();
         } else {
             qWarning() << "Event with ID " << oldId << " not found.";
         }
@@ -166,6 +388,44 @@ void Controller::updateEvent(int oldId, const Event& newEvent) {
     }
 }
 
+void Controller::updateEventFields(int id, EventFields fields, EventFieldValues values) {
+    METRIC_LATENCY("controller.update_event_fields");
+    TRACE_SCOPE("controller", "Controller::updateEventFields");
+    if (m_recorder) {
+        m_recorder->record(RecordedOperation::forEventFields(id, fields, values));
+    }
+    if (m_eventRepo) {
+        if (!fields) {
+            qDebug() << "No event fields to update for ID" << id;
+            return;
+        }
+        if (const Event* existing = m_eventRepo->findById(id)) {
+            if (fields.testAnyFlags(EventField::Date | EventField::Volunteers)) {
+                const QDate date = fields.testFlag(EventField::Date) ? values.date : existing->getDate();
+                const QList<int> joining = joiningVolunteers(
+                    *existing, date, fields.testFlag(EventField::Volunteers) ? values.volunteerIds : existing->getVolunteerIds());
+                if (!admitsDoubleBooking(id, date, describeEvents("events", bookingConflicts(joining, date, id)))) {
+                    return;
+                }
+            }
+            std::unique_ptr<Command> command = std::make_unique<PatchEventCommand>(m_eventRepo.get(), id, fields, std::move(values));
+            command->execute();
+            publishSnapshot();
+            m_undoStack.push(std::move(command));
+
+            while (!m_redoStack.empty()) {
+                m_redoStack.pop();
+            }
+
+            qDebug() << "Event fields updated for ID" << id;
+        } else {
+            qWarning() << "Event with ID " << id << " not found.";
+        }
+    } else {
+        qWarning() << "Event Repository not available. Cannot update event.";
+    }
+}
+
 std::vector<Event> Controller::getAllEvents() const {
     if (m_eventRepo) {
         return m_eventRepo->getAll();
@@ -175,132 +435,642 @@ std::vector<Event> Controller::getAllEvents() const {
     }
 }
 
+QueryPage<Event> Controller::queryEvents(const EventFilter& filter, EventSortKey sortKey,
+                                         int offset, int limit, SortOrder order) const {
+    METRIC_LATENCY("controller.query_events");
+    TRACE_SCOPE("controller", "Controller::queryEvents");
+    QueryPage<Event> page;
+    if (!m_eventRepo) {
+        qWarning() << "Event Repository not available. Cannot query events.";
+        return page;
+    }
+
+    if (sortKey == EventSortKey::Title && !m_eventTitleKeys.isBuilt()) {
+        m_eventTitleKeys.build(*m_eventRepo);
+    }
+
+    // Collect pointers into the repository storage; only the page itself is copied. The matching IDs
+    // come from the filter cache, so paging through one filter scans the events once.
+    const std::shared_ptr<const std::vector<int>> ids = matchingEventIds(filter);
+    std::vector<SortCandidate<Event>> candidates;
+    candidates.reserve(ids->size());
+    for (int id : *ids) {
+        const Event* event = m_eventRepo->findById(id);
+        const QCollatorSortKey* key = sortKey == EventSortKey::Title ? m_eventTitleKeys.find(id) : nullptr;
+        candidates.push_back({event, key});
+    }
+    page.total = static_cast<int>(candidates.size());
+
+    auto less = [sortKey](const SortCandidate<Event>& a, const SortCandidate<Event>& b) {
+        int cmp = 0;
+        switch (sortKey) {
+        case EventSortKey::Id:
+            break;
+        case EventSortKey::Title:
+            cmp = a.key->compare(*b.key);
+            break;
+        case EventSortKey::Date:
+            cmp = a.item->getDate().toJulianDay() < b.item->getDate().toJulianDay() ? -1
+                : a.item->getDate().toJulianDay() > b.item->getDate().toJulianDay() ? 1 : 0;
+            break;
+        case EventSortKey::Location:
+            cmp = QString::compare(a.item->getLocation(), b.item->getLocation(), Qt::CaseInsensitive);
+            break;
+        }
+        return cmp != 0 ? cmp < 0 : a.item->getId() < b.item->getId();
+    };
+    page.items = selectPage(candidates, offset, limit, order, less);
+    return page;
+}
+
+ImportResult Controller::importEvents(const std::vector<Event>& events, ImportIds ids) {
+    METRIC_LATENCY("controller.import_events");
+    TRACE_SCOPE("controller", "Controller::importEvents");
+    if (m_recorder) {
+        m_recorder->record(RecordedOperation::forImport(static_cast<int>(ids), events));
+    }
+    ImportResult result;
+    if (!m_eventRepo || !m_volunteerRepo) {
+        qWarning() << "Repository not available. Cannot import events.";
+        return result;
+    }
+
+    QSet<int> existingIds;
+    std::vector<Event> renumbered;
+    if (ids == ImportIds::Assign) {
+        // Validated under row numbers; only accepted rows take a repository ID, so rejects use none up
+        renumbered.reserve(events.size());
+        for (std::size_t row = 0; row < events.size(); ++row) {
+            const Event& event = events[row];
+            renumbered.emplace_back(static_cast<int>(row) + 1, event.getTitle(), event.getDate(), event.getLocation(),
+                                    event.getVolunteerIds());
+        }
+    } else {
+        for (const auto& event : m_eventRepo->getAll()) {
+            existingIds.insert(event.getId());
+        }
+    }
+    const std::vector<Event>& rows = ids == ImportIds::Assign ? renumbered : events;
+    QSet<int> volunteerIds;
+    for (const auto& volunteer : m_volunteerRepo->getAll()) {
+        volunteerIds.insert(volunteer.getId());
+    }
+
+    const std::size_t firstIssue = result.issues.size();
+    std::vector<Event> validated = BulkImporter::validateEvents(rows, existingIds, volunteerIds, result.issues);
+
+    // Same-day double bookings, against stored events and between the imported rows. Rows are tracked by
+    // their validated ID (the placeholder under ImportIds::Assign) and named by the caller's ID.
+    const auto callerId = [&](int rowId) { return ids == ImportIds::Assign ? events[rowId - 1].getId() : rowId; };
+    std::vector<Event> accepted;
+    accepted.reserve(validated.size());
+    QHash<std::pair<int, qint64>, int> importedSlots; // (volunteer, julian day) -> accepted row
+    for (Event& event : validated) {
+        const QList<int> stored = bookingConflicts(event.getVolunteerIds(), event.getDate(), -1);
+        const qint64 day = event.getDate().toJulianDay();
+        QList<int> clashingRows;
+        if (event.getDate().isValid()) {
+            for (int volunteerId : event.getVolunteerIds()) {
+                auto slot = importedSlots.constFind({volunteerId, day});
+                if (slot != importedSlots.constEnd() && !clashingRows.contains(slot.value())) {
+                    clashingRows.append(slot.value());
+                }
+            }
+        }
+        QList<int> clashingCallerIds;
+        for (int rowId : clashingRows) {
+            clashingCallerIds.append(callerId(rowId));
+        }
+        QStringList clashes;
+        for (const QString& clash : {describeEvents("events", stored), describeEvents("imported events", clashingCallerIds)}) {
+            if (!clash.isEmpty()) {
+                clashes.append(clash);
+            }
+        }
+        const QString clashesWith = clashes.join(" and ");
+        if (!admitsDoubleBooking(callerId(event.getId()), event.getDate(), clashesWith)) {
+            result.issues.push_back({event.getId(), QString("Double-books volunteers with %1").arg(clashesWith)});
+            continue;
+        }
+        if (event.getDate().isValid()) {
+            for (int volunteerId : event.getVolunteerIds()) {
+                importedSlots.insert({volunteerId, day}, event.getId());
+            }
+        }
+        accepted.push_back(std::move(event));
+    }
+
+    if (ids == ImportIds::Assign) {
+        for (std::size_t i = firstIssue; i < result.issues.size(); ++i) {
+            result.issues[i].id = events[result.issues[i].id - 1].getId(); // Report the row's own ID
+        }
+        for (Event& event : accepted) {
+            event = Event(m_eventRepo->nextId(), event.getTitle(), event.getDate(), event.getLocation(), event.getVolunteerIds());
+        }
+    }
+    if (!accepted.empty()) {
+        result.imported = static_cast<int>(accepted.size());
+        std::unique_ptr<Command> command = std::make_unique<ImportEventsCommand>(m_eventRepo.get(), accepted);
+        command->execute();
+        publishSnapshot();
+        m_undoStack.push(std::move(command));
+
+        while (!m_redoStack.empty()) {
+            m_redoStack.pop();
+        }
+    }
+
+    qDebug() << "Imported" << result.imported << "events," << result.issues.size() << "rejected.";
+    return result;
+}
+
+ImportResult Controller::importEvents(const QString& filename) {
+    std::vector<ImportIssue> parseIssues;
+    std::vector<Event> events = BulkImporter::readEvents(filename, parseIssues);
+    ImportResult result = importEvents(events);
+    result.issues.insert(result.issues.begin(), parseIssues.begin(), parseIssues.end());
+    return result;
+}
+
 // --- Volunteer-Event Association Implementations ---
 
-void Controller::addVolunteerToEvent(int volunteerId, int eventId) {
+bool Controller::addVolunteerToEvent(int volunteerId, int eventId) {
+    METRIC_LATENCY("controller.add_volunteer_to_event");
+    TRACE_SCOPE("controller", "Controller::addVolunteerToEvent");
+    if (m_recorder) {
+        m_recorder->record({.type = OperationType::AssignVolunteer, .id = volunteerId, .otherId = eventId});
+    }
     if (!m_eventRepo || !m_volunteerRepo) {
         qWarning() << "Repository not available. Cannot add volunteer to event.";
-        return;
+        return false;
     }
 
     // Find the volunteer and event (for validation, if needed)
-    std::vector<Volunteer> volunteers = m_volunteerRepo->getAll();
-    auto volunteerIt = std::find_if(volunteers.begin(), volunteers.end(),
-                                  [volunteerId](const Volunteer& v) { return v.getId() == volunteerId; });
+    const Volunteer* volunteer = m_volunteerRepo->findById(volunteerId);
+    const Event* event = m_eventRepo->findById(eventId);
 
-    std::vector<Event> events = m_eventRepo->getAll();
-    auto eventIt = std::find_if(events.begin(), events.end(),
-                               [eventId](const Event& e) { return e.getId() == eventId; });
-
-    if (volunteerIt == volunteers.end()) {
+    if (!volunteer) {
         qWarning() << "Volunteer with ID" << volunteerId << "not found. Cannot associate with event.";
-        return;
+        return false;
     }
 
-    if (eventIt == events.end()) {
+    if (!event) {
         qWarning() << "Event with ID" << eventId << "not found.";
-        return;
+        return false;
+    }
+
+    // Same volunteer, same day, different event: one hash lookup in the booking index
+    const QList<int> conflicts = m_bookingIndex.conflictsFor(volunteerId, event->getDate(), eventId);
+    if (!conflicts.isEmpty()) {
+        if (m_doubleBookingPolicy == DoubleBookingPolicy::Reject) {
+            METRIC_COUNT("controller.double_booking_rejected");
+            qWarning() << "Volunteer" << volunteerId << "is already booked on" << event->getDate().toString("yyyy-MM-dd")
+                       << "by events" << conflicts << ". Assignment to Event" << eventId << "rejected.";
+            return false;
+        }
+        METRIC_COUNT("controller.double_booking_warned");
+        qWarning() << "Volunteer" << volunteerId << "double-booked on" << event->getDate().toString("yyyy-MM-dd")
+                   << "with events" << conflicts;
     }
 
     // Create a modifiable copy of the event
-    Event eventToUpdate = *eventIt;
+    Event eventToUpdate = *event;
     eventToUpdate.addVolunteer(volunteerId);
 
     // No command for this, updating directly
     m_eventRepo->update(eventToUpdate); // Update the event in the repository
+    publishSnapshot();
     qDebug() << "Volunteer" << volunteerId << "added to Event" << eventId;
+    return true;
 }
 
 void Controller::removeVolunteerFromEvent(int volunteerId, int eventId) {
+    METRIC_LATENCY("controller.remove_volunteer_from_event");
+    TRACE_SCOPE("controller", "Controller::removeVolunteerFromEvent");
+    if (m_recorder) {
+        m_recorder->record({.type = OperationType::UnassignVolunteer, .id = volunteerId, .otherId = eventId});
+    }
     if (!m_eventRepo || !m_volunteerRepo) {
         qWarning() << "Repository not available. Cannot remove volunteer from event.";
         return;
     }
 
     // Find the event
-    std::vector<Event> events = m_eventRepo->getAll();
-    auto eventIt = std::find_if(events.begin(), events.end(),
-                               [eventId](const Event& e) { return e.getId() == eventId; });
+    const Event* event = m_eventRepo->findById(eventId);
 
-    if (eventIt == events.end()) {
+    if (!event) {
         qWarning() << "Event with ID" << eventId << "not found.";
         return;
     }
 
-    Event eventToUpdate = *eventIt;
+    Event eventToUpdate = *event;
     eventToUpdate.removeVolunteer(volunteerId);
     m_eventRepo->update(eventToUpdate); // Update the event in the repository
+    publishSnapshot();
     qDebug() << "Volunteer" << volunteerId << "removed from Event" << eventId;
 }
 
+void Controller::setDoubleBookingPolicy(DoubleBookingPolicy policy) {
+    m_doubleBookingPolicy = policy;
+}
+
+DoubleBookingPolicy Controller::doubleBookingPolicy() const {
+    return m_doubleBookingPolicy;
+}
+
+std::vector<BookingConflict> Controller::findBookingConflicts() const {
+    METRIC_LATENCY("controller.find_booking_conflicts");
+    TRACE_SCOPE("controller", "Controller::findBookingConflicts");
+    if (!m_eventRepo) {
+        qWarning() << "Event Repository not available. Cannot scan for booking conflicts.";
+        return {};
+    }
+    return BookingIndex::scanConflicts(*m_eventRepo);
+}
+
 void Controller::undo() {
+    METRIC_LATENCY("controller.undo");
+    TRACE_SCOPE("controller", "Controller::undo");
+    if (m_recorder) {
+        m_recorder->record({.type = OperationType::Undo});
+    }
     qDebug() << "Undo functionality to be implemented using Command Pattern.";
     if (!m_undoStack.empty()) {
         std::unique_ptr<Command> command = std::move(m_undoStack.top());
         m_undoStack.pop();
         command->undo();
+        publishSnapshot();
         m_redoStack.push(std::move(command));
     } else {
+        METRIC_COUNT("controller.undo_empty");
         qDebug() << "Undo stack is empty.";
     }
 }
 
 void Controller::redo() {
+    METRIC_LATENCY("controller.redo");
+    TRACE_SCOPE("controller", "Controller::redo");
+    if (m_recorder) {
+        m_recorder->record({.type = OperationType::Redo});
+    }
     qDebug() << "Redo functionality to be implemented using Command Pattern.";
     if (!m_redoStack.empty()) {
         std::unique_ptr<Command> command = std::move(m_redoStack.top());
         m_redoStack.pop();
         command->execute();
+        publishSnapshot();
         m_undoStack.push(std::move(command));
     } else {
+        METRIC_COUNT("controller.redo_empty");
         qDebug() << "Redo Stack is empty.";
     }
 }
 
 std::vector<Event> Controller::filterEventsByDate(const QString& dateFilter) const {
+    METRIC_LATENCY("controller.filter_events_by_date");
+    TRACE_SCOPE("controller", "Controller::filterEventsByDate");
+    if (m_recorder) {
+        m_recorder->record({.type = OperationType::FilterByDate, .text = dateFilter});
+    }
     qDebug() << "Controller::filterEventsByDate: dateFilter =" << dateFilter;
     std::vector<Event> filteredList;
-    qDebug() << "Controller::filterEventsByDate: m_eventRepo =" << (m_eventRepo != nullptr); // Check repo validity
 
     if (!m_eventRepo) {
         qWarning() << "Controller::filterEventsByDate: m_eventRepo is null! Returning empty list.";
         return filteredList; // Return early if repo is invalid
     }
 
-    std::vector<Event> allEvents = m_eventRepo->getAll(); // Store the result
-    qDebug() << "Controller::filterEventsByDate: allEvents.size() =" << allEvents.size();
-
-    std::copy_if(allEvents.begin(), allEvents.end(),
-                  std::back_inserter(filteredList),
-                  [&](const Event& event) {
-                      bool match = dateFilter.isEmpty() || event.getDate().toString("yyyy-MM-dd") == dateFilter;
-                      qDebug() << "  Checking event: " << event.getId() << ", date=" << event.getDate().toString("yyyy-MM-dd") << ", match=" << match;
-                      return match;
-                  });
+    EventFilter filter;
+    if (!dateFilter.isEmpty()) {
+        const QDate date = QDate::fromString(dateFilter, "yyyy-MM-dd");
+        // Only an exact yyyy-MM-dd string can equal a stored date
+        if (!date.isValid() || date.toString("yyyy-MM-dd") != dateFilter) {
+            return filteredList;
+        }
+        filter.from = date;
+        filter.to = date;
+    }
+    filteredList = eventsByIds(*matchingEventIds(filter));
     qDebug() << "Controller::filterEventsByDate: filteredList.size() =" << filteredList.size();
     return filteredList;
 }
 
 std::vector<Event> Controller::filterEventsByLocation(const QString& locationFilter) const {
+    METRIC_LATENCY("controller.filter_events_by_location");
+    TRACE_SCOPE("controller", "Controller::filterEventsByLocation");
+    if (m_recorder) {
+        m_recorder->record({.type = OperationType::FilterByLocation, .text = locationFilter});
+    }
     qDebug() << "Controller::filterEventsByLocation: locationFilter =" << locationFilter; // ADDED
     std::vector<Event> filteredList;
-    qDebug() << "Controller::filterEventsByLocation: m_eventRepo =" << (m_eventRepo != nullptr); // Check repo validity
 
     if (!m_eventRepo) {
         qWarning() << "Controller::filterEventsByLocation: m_eventRepo is null! Returning empty list.";
         return filteredList; // Return early if repo is invalid
     }
 
-    std::vector<Event> allEvents = m_eventRepo->getAll(); // Store the result
-    qDebug() << "Controller::filterEventsByLocation: allEvents.size() =" << allEvents.size(); // ADDED
-
-    std::copy_if(allEvents.begin(), allEvents.end(),
-                  std::back_inserter(filteredList),
-                  [&](const Event& event) {
-                      bool match = locationFilter.isEmpty() || event.getLocation().contains(locationFilter, Qt::CaseInsensitive);
-                      qDebug() << "  Checking event: " << event.getId() << ", location=" << event.getLocation() << ", match=" << match; // ADDED
-                      return match;
-                  });
+    EventFilter filter;
+    filter.locationContains = locationFilter;
+    filteredList = eventsByIds(*matchingEventIds(filter));
     qDebug() << "Controller::filterEventsByLocation: filteredList.size() =" << filteredList.size(); // ADDED
     return filteredList;
+}
+
+std::shared_ptr<const std::vector<int>> Controller::matchingEventIds(const EventFilter& filter) const {
+    METRIC_LATENCY("controller.matching_event_ids");
+    TRACE_SCOPE("controller", "Controller::matchingEventIds");
+    if (!m_eventRepo) {
+        qWarning() << "Event Repository not available. Cannot filter events.";
+        return std::make_shared<const std::vector<int>>();
+    }
+    const QString key = filter.cacheKey();
+    const std::uint64_t generation = m_eventRepo->generation();
+    if (auto cached = m_eventFilterCache.find(key, generation)) {
+        return cached;
+    }
+    auto ids = std::make_shared<std::vector<int>>();
+    m_eventRepo->forEach([&](const Event& event) {
+        if (filter.matches(event)) {
+            ids->push_back(event.getId());
+        }
+    });
+    m_eventFilterCache.insert(key, generation, ids);
+    return ids;
+}
+
+std::shared_ptr<const std::vector<int>> Controller::cachedEventIds(const EventFilter& filter) const {
+    if (!m_eventRepo) {
+        return nullptr;
+    }
+    return m_eventFilterCache.find(filter.cacheKey(), m_eventRepo->generation());
+}
+
+void Controller::cacheEventIds(const EventFilter& filter, std::uint64_t generation, std::vector<int> ids) const {
+    m_eventFilterCache.insert(filter.cacheKey(), generation, std::make_shared<const std::vector<int>>(std::move(ids)));
+}
+
+std::uint64_t Controller::eventGeneration() const {
+    return m_eventRepo ? m_eventRepo->generation() : 0;
+}
+
+void Controller::setQueryCacheCapacity(std::size_t capacity) {
+    m_eventFilterCache.setCapacity(capacity);
+}
+
+QList<int> Controller::bookingConflicts(const QList<int>& volunteerIds, const QDate& date, int eventId) const {
+    QList<int> conflicts;
+    for (int volunteerId : volunteerIds) {
+        for (int other : m_bookingIndex.conflictsFor(volunteerId, date, eventId)) {
+            if (!conflicts.contains(other)) {
+                conflicts.append(other);
+            }
+        }
+    }
+    return conflicts;
+}
+
+bool Controller::admitsDoubleBooking(int eventId, const QDate& date, const QString& clashesWith) const {
+    if (clashesWith.isEmpty()) {
+        return true;
+    }
+    if (m_doubleBookingPolicy == DoubleBookingPolicy::Reject) {
+        METRIC_COUNT("controller.double_booking_rejected");
+        qWarning() << "Event" << eventId << "would double-book volunteers on" << date.toString("yyyy-MM-dd")
+                   << "with" << clashesWith << ". Change rejected.";
+        return false;
+    }
+    METRIC_COUNT("controller.double_booking_warned");
+    qWarning() << "Event" << eventId << "double-books volunteers on" << date.toString("yyyy-MM-dd") << "with" << clashesWith;
+    return true;
+}
+
+// Copies the events with these IDs, in the given order
+std::vector<Event> Controller::eventsByIds(const std::vector<int>& ids) const {
+    std::vector<Event> events;
+    events.reserve(ids.size());
+    for (int id : ids) {
+        if (const Event* event = m_eventRepo->findById(id)) {
+            events.push_back(*event);
+        }
+    }
+    return events;
+}
+
+std::vector<Event> Controller::upcomingEvents(const QDate& from, int n) const {
+    METRIC_LATENCY("controller.upcoming_events");
+    TRACE_SCOPE("controller", "Controller::upcomingEvents");
+    std::vector<Event> events;
+    if (!m_eventRepo) {
+        qWarning() << "Event Repository not available. Cannot get upcoming events.";
+        return events;
+    }
+
+    if (!m_eventDateIndex.isBuilt()) {
+        m_eventDateIndex.build(*m_eventRepo);
+    }
+    for (int id : m_eventDateIndex.upcoming(from, n)) {
+        if (const Event* event = m_eventRepo->findById(id)) {
+            events.push_back(*event);
+        }
+    }
+    return events;
+}
+
+const EventAggregates& Controller::aggregates() const {
+    return m_eventAggregates;
+}
+
+bool Controller::verifyAggregates() {
+    if (!m_eventRepo) {
+        qWarning() << "Event Repository not available. Cannot verify aggregates.";
+        return false;
+    }
+
+    EventAggregates recounted;
+    recounted.rebuild(*m_eventRepo);
+    if (recounted == m_eventAggregates) {
+        return true;
+    }
+    qWarning() << "Event aggregates drifted from the repository contents; rebuilding.";
+    m_eventAggregates = recounted;
+    return false;
+}
+
+qint64 Controller::exportEventReport(const QString& filename, const ExportOptions& options) const {
+    METRIC_LATENCY("controller.export_event_report");
+    TRACE_SCOPE("controller", "Controller::exportEventReport");
+    if (!m_eventRepo || !m_volunteerRepo) {
+        qWarning() << "Repository not available. Cannot export event report.";
+        return -1;
+    }
+    ReportExporter exporter(m_volunteerRepo.get(), m_eventRepo.get());
+    return exporter.exportEvents(filename, options);
+}
+
+void Controller::setSnapshotReads(bool enabled) {
+    if (enabled == snapshotReads()) {
+        return;
+    }
+    if (!enabled) {
+        m_volunteerRepo->removeObserver(m_volunteerSnapshots.get());
+        m_eventRepo->removeObserver(m_eventSnapshots.get());
+        m_volunteerSnapshots.reset();
+        m_eventSnapshots.reset();
+        m_snapshot.store(nullptr, std::memory_order_release);
+        qDebug() << "Snapshot reads disabled.";
+        return;
+    }
+    if (!m_eventRepo || !m_volunteerRepo) {
+        qWarning() << "Repository not available. Cannot enable snapshot reads.";
+        return;
+    }
+    m_volunteerSnapshots = std::make_unique<SnapshotStore<Volunteer>>();
+    m_volunteerSnapshots->rebuild(*m_volunteerRepo);
+    m_volunteerRepo->addObserver(m_volunteerSnapshots.get());
+    m_eventSnapshots = std::make_unique<SnapshotStore<Event>>();
+    m_eventSnapshots->rebuild(*m_eventRepo);
+    m_eventRepo->addObserver(m_eventSnapshots.get());
+    publishSnapshot();
+    qDebug() << "Snapshot reads enabled.";
+}
+
+bool Controller::snapshotReads() const {
+    return m_eventSnapshots != nullptr;
+}
+
+std::shared_ptr<const ControllerSnapshot> Controller::snapshot() const {
+    return m_snapshot.load(std::memory_order_acquire);
+}
+
+void Controller::publishSnapshot() {
+    if (!m_eventSnapshots || (!m_volunteerSnapshots->isDirty() && !m_eventSnapshots->isDirty())) {
+        return;
+    }
+    METRIC_LATENCY("controller.publish_snapshot");
+    // Readers holding the previous version keep it alive; it is freed when the last one lets go
+    auto published = std::make_shared<ControllerSnapshot>();
+    published->volunteers = m_volunteerSnapshots->snapshot(m_volunteerRepo->generation());
+    published->events = m_eventSnapshots->snapshot(m_eventRepo->generation());
+    m_snapshot.store(std::move(published), std::memory_order_release);
+}
+
+const Volunteer* Controller::findVolunteer(int id) const {
+    return m_volunteerRepo ? m_volunteerRepo->findById(id) : nullptr;
+}
+
+const Event* Controller::findEvent(int id) const {
+    return m_eventRepo ? m_eventRepo->findById(id) : nullptr;
+}
+
+int Controller::volunteerCount() const {
+    return m_volunteerRepo ? static_cast<int>(m_volunteerRepo->count()) : 0;
+}
+
+const Volunteer& Controller::volunteerAt(int row) const {
+    return m_volunteerRepo->at(static_cast<std::size_t>(row));
+}
+
+int Controller::volunteerRow(int id) const {
+    return m_volunteerRepo ? m_volunteerRepo->positionOf(id) : -1;
+}
+
+int Controller::eventCount() const {
+    return m_eventRepo ? static_cast<int>(m_eventRepo->count()) : 0;
+}
+
+const Event& Controller::eventAt(int row) const {
+    return m_eventRepo->at(static_cast<std::size_t>(row));
+}
+
+int Controller::eventRow(int id) const {
+    return m_eventRepo ? m_eventRepo->positionOf(id) : -1;
+}
+
+ChangeNotifier* Controller::changeNotifier() {
+    return &m_changeNotifier;
+}
+
+MetricsSnapshot Controller::metricsSnapshot() const {
+    publishMemoryUsage();
+    return MetricsRegistry::instance().snapshot();
+}
+
+// std::stack hides its container; a derived accessor reads it without copying
+template <typename Stack>
+static const typename Stack::container_type& stackContents(const Stack& stack) {
+    struct Access : Stack {
+        static const typename Stack::container_type& of(const Stack& s) { return s.*&Access::c; }
+    };
+    return Access::of(stack);
+}
+
+MemoryReport Controller::memoryUsage() const {
+    MemoryReport report;
+    if (m_volunteerRepo) {
+        report.volunteers = m_volunteerRepo->memoryUsage();
+    }
+    if (m_eventRepo) {
+        report.events = m_eventRepo->memoryUsage();
+    }
+    for (const auto& command : stackContents(m_undoStack)) {
+        report.undoStack += command->memoryUsage();
+        report.undoStack.objectBytes += sizeof(command);
+    }
+    for (const auto& command : stackContents(m_redoStack)) {
+        report.redoStack += command->memoryUsage();
+        report.redoStack.objectBytes += sizeof(command);
+    }
+    report.indexes.indexBytes = m_volunteerNameKeys.memoryBytes() + m_eventTitleKeys.memoryBytes()
+                                + m_eventDateIndex.memoryBytes() + m_bookingIndex.memoryBytes()
+                                + m_eventAggregates.memoryBytes() + m_eventFilterCache.memoryBytes();
+    if (m_volunteerSnapshots) {
+        report.indexes.objectBytes += m_volunteerSnapshots->memoryBytes();
+    }
+    if (m_eventSnapshots) {
+        report.indexes.objectBytes += m_eventSnapshots->memoryBytes();
+    }
+    return report;
+}
+
+void Controller::publishMemoryUsage() const {
+    const MemoryReport report = memoryUsage();
+    const std::pair<const char*, const MemoryUsage*> sections[] = {
+        {"volunteers", &report.volunteers}, {"events", &report.events},
+        {"undo_stack", &report.undoStack}, {"redo_stack", &report.redoStack}, {"indexes", &report.indexes}};
+    MetricsRegistry& registry = MetricsRegistry::instance();
+    for (const auto& [section, usage] : sections) {
+        const QString prefix = QString("memory.%1.").arg(section);
+        registry.gauge(prefix + "items").set(static_cast<qint64>(usage->items));
+        registry.gauge(prefix + "bytes").set(static_cast<qint64>(usage->totalBytes()));
+        registry.gauge(prefix + "object_bytes").set(static_cast<qint64>(usage->objectBytes));
+        registry.gauge(prefix + "string_bytes").set(static_cast<qint64>(usage->stringBytes));
+        registry.gauge(prefix + "list_bytes").set(static_cast<qint64>(usage->listBytes));
+        registry.gauge(prefix + "index_bytes").set(static_cast<qint64>(usage->indexBytes));
+    }
+    registry.gauge("memory.total_bytes").set(static_cast<qint64>(report.totalBytes()));
+}
+
+void Controller::startMetricsDump(const QString& filename, MetricsFormat format, int intervalMs) {
+    m_metricsDumper = std::make_unique<MetricsDumper>(filename, format, intervalMs);
+    m_metricsDumper->setBeforeDump([this]() { publishMemoryUsage(); });
+    m_metricsDumper->start();
+    qDebug() << "Dumping metrics to" << filename << "every" << intervalMs << "ms.";
+}
+
+void Controller::stopMetricsDump() {
+    m_metricsDumper.reset();
+}
+
+bool Controller::startRecording(const QString& filename) {
+    auto recorder = std::make_unique<OperationRecorder>();
+    if (!recorder->open(filename)) {
+        return false;
+    }
+    m_recorder = std::move(recorder);
+    qDebug() << "Recording operations to" << filename;
+    return true;
+}
+
+void Controller::stopRecording() {
+    m_recorder.reset();
 }
\ No newline at end of file
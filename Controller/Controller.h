@@ -5,10 +5,31 @@
 #include <vector>
 #include <memory>
 #include <stack>
+#include <atomic>
 #include "../Model/Volunteer.h"
 #include "../Model/Event.h"
+#include "../Model/EventFields.h"
 #include "../Repository/BaseRepository.h" // Include the BaseRepository header
 #include "../core/Command/Command.h"       // Include the Command interface
+#include "../core/Import/BulkImporter.h"
+#include "../core/Export/ReportExporter.h"
+#include "../core/Query/Query.h"
+#include "../core/Query/CollationIndex.h"
+#include "../core/Query/EventDateIndex.h"
+#include "../core/Query/QueryCache.h"
+#include "../core/Snapshot/RepositorySnapshot.h"
+#include "../core/Aggregate/EventAggregates.h"
+#include "../core/Booking/BookingIndex.h"
+#include "../core/Notify/ChangeNotifier.h"
+#include "../core/Metrics/MetricsDumper.h"
+
+class OperationRecorder;
+
+// Both repositories as of one change made through the controller; immutable, readable from any thread
+struct ControllerSnapshot {
+    std::shared_ptr<const RepositorySnapshot<Volunteer>> volunteers;
+    std::shared_ptr<const RepositorySnapshot<Event>> events;
+};
 
 class Controller {
 public:
@@ -17,28 +38,147 @@ public:
     ~Controller();
 
     void addVolunteer(const Volunteer& volunteer);
+    // Rvalue overloads move the volunteer through the undo command into storage without copying it
+    void addVolunteer(Volunteer&& volunteer);
+    // Adds a volunteer under an ID chosen by the repository; returns that ID, or -1 on failure
+    int addVolunteer(QString name, QString contactInfo);
+    // Builds the volunteer from Volunteer constructor arguments, ID included, and adds it
+    template <typename... Args>
+    void emplaceVolunteer(Args&&... args) {
+        addVolunteer(Volunteer(std::forward<Args>(args)...));
+    }
     void removeVolunteer(int id);
     void updateVolunteer(int oldId, const Volunteer& newVolunteer);
+    void updateVolunteer(int oldId, Volunteer&& newVolunteer);
     std::vector<Volunteer> getAllVolunteers() const;
+    QueryPage<Volunteer> queryVolunteers(const VolunteerFilter& filter, VolunteerSortKey sortKey, int offset, int limit,
+                                         SortOrder order = SortOrder::Ascending) const;
+    ImportResult importVolunteers(const std::vector<Volunteer>& volunteers, ImportIds ids = ImportIds::Keep);
+    ImportResult importVolunteers(const QString& filename);
 
     void addEvent(const Event& event);
+    void addEvent(Event&& event);
+    // Adds an event under an ID chosen by the repository; returns that ID, or -1 on failure
+    int addEvent(QString title, QDate date, QString location);
+    // Builds the event from Event constructor arguments, ID included, and adds it
+    template <typename... Args>
+    void emplaceEvent(Args&&... args) {
+        addEvent(Event(std::forward<Args>(args)...));
+    }
     void removeEvent(int id);
     void updateEvent(int oldId, const Event& newEvent);
+    void updateEvent(int oldId, Event&& newEvent);
+    // Changes only the fields in mask, read from values; undo restores just those fields.
+    // Indexes that do not depend on the patched fields are not touched.
+    void updateEventFields(int id, EventFields fields, EventFieldValues values);
     std::vector<Event> getAllEvents() const;
+    QueryPage<Event> queryEvents(const EventFilter& filter, EventSortKey sortKey, int offset, int limit,
+                                 SortOrder order = SortOrder::Ascending) const;
+    ImportResult importEvents(const std::vector<Event>& events, ImportIds ids = ImportIds::Keep);
+    ImportResult importEvents(const QString& filename);
 
-    void addVolunteerToEvent(int volunteerId, int eventId);
+    // Returns false if either id is unknown or the assignment is rejected as a double booking
+    bool addVolunteerToEvent(int volunteerId, int eventId);
     void removeVolunteerFromEvent(int volunteerId, int eventId);
+    void setDoubleBookingPolicy(DoubleBookingPolicy policy);
+    DoubleBookingPolicy doubleBookingPolicy() const;
+    // Every volunteer booked on more than one event the same day, ordered by volunteer then date
+    std::vector<BookingConflict> findBookingConflicts() const;
 
     void undo();
     void redo();
 
     std::vector<Event> filterEventsByDate(const QString& dateFilter) const;
     std::vector<Event> filterEventsByLocation(const QString& locationFilter) const;
+
+    // IDs of the events matching filter, in storage order. Results are cached per normalized filter
+    // in a bounded LRU and reused until the next event change.
+    std::shared_ptr<const std::vector<int>> matchingEventIds(const EventFilter& filter) const;
+    // Cache access for scans that run elsewhere, e.g. on a worker over a snapshot: look up first, and
+    // on a miss store the result under the eventGeneration() read when the snapshot was taken
+    std::shared_ptr<const std::vector<int>> cachedEventIds(const EventFilter& filter) const;
+    void cacheEventIds(const EventFilter& filter, std::uint64_t generation, std::vector<int> ids) const;
+    std::uint64_t eventGeneration() const;
+    // Number of filter results kept; 0 disables caching
+    void setQueryCacheCapacity(std::size_t capacity);
+
+    // The first n events dated on or after from, earliest first, served from a date index
+    std::vector<Event> upcomingEvents(const QDate& from, int n) const;
+
+    // Per-location / per-month / per-volunteer counters, kept current on every change
+    const EventAggregates& aggregates() const;
+    // Recounts from the repository; returns false (and repairs the view) if the counters had drifted
+    bool verifyAggregates();
+
+    // O(1) lookups through the repository indexes; nullptr if absent, invalidated by the next change
+    const Volunteer* findVolunteer(int id) const;
+    const Event* findEvent(int id) const;
+
+    // Row access in storage order for lazy item models; a reference is valid until the next change
+    int volunteerCount() const;
+    const Volunteer& volunteerAt(int row) const;
+    int volunteerRow(int id) const; // -1 if there is no such volunteer
+    int eventCount() const;
+    const Event& eventAt(int row) const;
+    int eventRow(int id) const;     // -1 if there is no such event
+
+    // Typed delta signals for every stored change; owned by the controller
+    ChangeNotifier* changeNotifier();
+
+    // Latency histograms and counters for every controller and repository operation (process-wide)
+    MetricsSnapshot metricsSnapshot() const;
+    // Estimated bytes held by each repository and by the undo/redo stacks; O(items)
+    MemoryReport memoryUsage() const;
+    // Samples memoryUsage() into the memory.* gauges; snapshots and dumps call this first
+    void publishMemoryUsage() const;
+    // Rewrites filename with a snapshot every intervalMs until stopped or the controller is destroyed
+    void startMetricsDump(const QString& filename, MetricsFormat format, int intervalMs);
+    void stopMetricsDump();
+
+    // Logs every add/update/remove, assignment, filter, undo and redo with its arguments, so the
+    // session can be replayed against another backend (see OperationReplayer)
+    bool startRecording(const QString& filename);
+    void stopRecording();
+
+    // Streams events joined with volunteer names; returns the number of rows or -1 on failure
+    qint64 exportEventReport(const QString& filename, const ExportOptions& options = ExportOptions()) const;
+
+    // Snapshot reads: single writer, any number of readers. While on, every change made through the
+    // controller publishes a new immutable version of both repositories. Readers on any thread take it
+    // with snapshot() and never lock; writers copy only the chunks they touch. Off by default.
+    void setSnapshotReads(bool enabled);
+    bool snapshotReads() const;
+    // The latest published version, or nullptr while snapshot reads are off; safe from any thread
+    std::shared_ptr<const ControllerSnapshot> snapshot() const;
 private:
     std::unique_ptr<BaseRepository<Volunteer>> m_volunteerRepo;
     std::unique_ptr<BaseRepository<Event>> m_eventRepo;
     std::stack<std::unique_ptr<Command>> m_undoStack;
     std::stack<std::unique_ptr<Command>> m_redoStack;
+
+    // Precomputed collation keys for sorted queries
+    mutable CollationIndex<Volunteer> m_volunteerNameKeys;
+    mutable CollationIndex<Event> m_eventTitleKeys;
+    mutable EventDateIndex m_eventDateIndex;
+    EventAggregates m_eventAggregates;
+    BookingIndex m_bookingIndex;
+    DoubleBookingPolicy m_doubleBookingPolicy = DoubleBookingPolicy::Reject;
+    ChangeNotifier m_changeNotifier;
+    mutable QueryCache<std::vector<int>> m_eventFilterCache{QStringLiteral("query_cache.event_filter"), 64};
+    std::unique_ptr<MetricsDumper> m_metricsDumper;
+    std::unique_ptr<OperationRecorder> m_recorder;
+    std::unique_ptr<SnapshotStore<Volunteer>> m_volunteerSnapshots;
+    std::unique_ptr<SnapshotStore<Event>> m_eventSnapshots;
+    std::atomic<std::shared_ptr<const ControllerSnapshot>> m_snapshot;
+
+    std::vector<Event> eventsByIds(const std::vector<int>& ids) const;
+    // Events other than eventId that already book one of volunteerIds on date
+    QList<int> bookingConflicts(const QList<int>& volunteerIds, const QDate& date, int eventId) const;
+    // Applies the double-booking policy to eventId clashing with the events described by clashesWith
+    // (empty when nothing clashes); false when the policy rejects it
+    bool admitsDoubleBooking(int eventId, const QDate& date, const QString& clashesWith) const;
+    // Writer side: swaps in a new version after a change when snapshot reads are on
+    void publishSnapshot();
 };
 
 #endif // CONTROLLER_H
\ No newline at end of file
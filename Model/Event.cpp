@@ -1,7 +1,14 @@
 #include "Event.h"
+#include <QSet>
 
-Event::Event(int id, const QString& title, const QDate& date, const QString& location) :
-    m_id(id), m_title(title), m_date(date), m_location(location) {}
+Event::Event(int id, QString title, QDate date, QString location) :
+    m_id(id), m_title(std::move(title)), m_date(date), m_location(std::move(location)) {}
+
+Event::Event(int id, QString title, QDate date, QString location, QList<int> volunteerIds) :
+    m_id(id), m_title(std::move(title)), m_date(date), m_location(std::move(location)),
+    m_volunteerIds(std::move(volunteerIds)) {
+    dropDuplicateVolunteers();
+}
 
 
 int Event::getId() const {
@@ -35,6 +42,11 @@ QList<int> Event::getVolunteerIds() const {
     return m_volunteerIds;
 }
 
+void Event::setVolunteerIds(QList<int> volunteerIds) {
+    m_volunteerIds = std::move(volunteerIds);
+    dropDuplicateVolunteers();
+}
+
 void Event::addVolunteer(int volunteerId) {
     if (! m_volunteerIds.contains(volunteerId)) {
         m_volunteerIds.append(volunteerId);
@@ -45,4 +57,18 @@ void Event::removeVolunteer(int volunteerId) {
     m_volunteerIds.removeAll(volunteerId);
 }
 
-
+// Keeps the first occurrence of each ID, in order
+void Event::dropDuplicateVolunteers() {
+    if (m_volunteerIds.size() < 2) {
+        return;
+    }
+    QSet<int> seen;
+    seen.reserve(m_volunteerIds.size());
+    m_volunteerIds.removeIf([&seen](int volunteerId) {
+        if (seen.contains(volunteerId)) {
+            return true;
+        }
+        seen.insert(volunteerId);
+        return false;
+    });
+}
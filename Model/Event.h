@@ -15,7 +15,10 @@ private:
     QList<int> m_volunteerIds;
 
 public:
-    Event(int id, const QString& title, const QDate& date, const QString& location);
+    // Strings and the ID list are taken by value so temporaries are moved in rather than copied
+    Event(int id, QString title, QDate date, QString location);
+    // Duplicate volunteer IDs are dropped, keeping the first occurrence, as addVolunteer() does
+    Event(int id, QString title, QDate date, QString location, QList<int> volunteerIds);
     int getId() const;
 
     QString getTitle() const;
@@ -28,8 +31,13 @@ public:
     void setLocation(const QString& location);
 
     QList<int> getVolunteerIds() const;
+    // Replaces the whole assignment list; duplicates are dropped as in the constructor
+    void setVolunteerIds(QList<int> volunteerIds);
     void addVolunteer(int volunteerId);
     void removeVolunteer(int volunteerId);
+
+private:
+    void dropDuplicateVolunteers();
 };
 
 #endif // EVENT_H
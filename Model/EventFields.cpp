@@ -0,0 +1,25 @@
+#include "EventFields.h"
+
+void swapEventFields(Event& event, EventFields fields, EventFieldValues& values) {
+    // Qt strings and lists are implicitly shared, so each exchange moves references, not data
+    if (fields.testFlag(EventField::Title)) {
+        QString previous = event.getTitle();
+        event.setTitle(values.title);
+        values.title = std::move(previous);
+    }
+    if (fields.testFlag(EventField::Date)) {
+        QDate previous = event.getDate();
+        event.setDate(values.date);
+        values.date = previous;
+    }
+    if (fields.testFlag(EventField::Location)) {
+        QString previous = event.getLocation();
+        event.setLocation(values.location);
+        values.location = std::move(previous);
+    }
+    if (fields.testFlag(EventField::Volunteers)) {
+        QList<int> previous = event.getVolunteerIds();
+        event.setVolunteerIds(std::move(values.volunteerIds));
+        values.volunteerIds = std::move(previous);
+    }
+}
@@ -0,0 +1,29 @@
+#ifndef EVENTFIELDS_H
+#define EVENTFIELDS_H
+
+#include "Event.h"
+#include <QFlags>
+
+// Event fields a partial update can change; the ID is never patched
+enum class EventField : quint32 {
+    Title = 0x1,
+    Date = 0x2,
+    Location = 0x4,
+    Volunteers = 0x8
+};
+Q_DECLARE_FLAGS(EventFields, EventField)
+Q_DECLARE_OPERATORS_FOR_FLAGS(EventFields)
+
+// New values for a partial update; only the fields named in the accompanying mask are read
+struct EventFieldValues {
+    QString title;
+    QDate date;
+    QString location;
+    QList<int> volunteerIds;
+};
+
+// Exchanges the masked fields between event and values, leaving every other field untouched.
+// values then holds what the event had, so applying the same call again restores it.
+void swapEventFields(Event& event, EventFields fields, EventFieldValues& values);
+
+#endif // EVENTFIELDS_H
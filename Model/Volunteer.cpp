@@ -1,7 +1,7 @@
 #include "Volunteer.h"
 
-Volunteer::Volunteer(int id, const QString& name, const QString& contactInfo) :
-    m_id(id), m_name(name), m_contactInfo(contactInfo){}
+Volunteer::Volunteer(int id, QString name, QString contactInfo) :
+    m_id(id), m_name(std::move(name)), m_contactInfo(std::move(contactInfo)){}
 
 int Volunteer::getId() const {
     return m_id;
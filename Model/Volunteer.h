@@ -10,7 +10,8 @@ private:
     QString m_contactInfo;
 
 public:
-    Volunteer(int id, const QString& name, const QString& contactInfo);
+    // Strings are taken by value so temporaries are moved in rather than copied
+    Volunteer(int id, QString name, QString contactInfo);
 
     int getId() const;
 
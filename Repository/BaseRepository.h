@@ -3,6 +3,14 @@
 
 #include <vector>
 #include <memory>
+#include <functional>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include "RepositoryObserver.h"
+#include "../core/Metrics/MemoryUsage.h"
 
 template <typename T>
 class BaseRepository {
@@ -13,6 +21,106 @@ public:
     virtual void remove(int id) = 0;
     virtual void update(const T& item) = 0;
     virtual std::vector<T> getAll() const = 0;
+
+    // Rvalue overloads move the item into storage; a rejected item is left untouched
+    virtual void add(T&& item) = 0;
+    virtual void update(T&& item) = 0;
+
+    // Builds the item in place from constructor arguments and moves it into storage
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        add(T(std::forward<Args>(args)...));
+    }
+
+    // Removes the item and hands it back rather than destroying it; empty when the ID is unknown
+    virtual std::optional<T> take(int id) = 0;
+    // Stores item in place of the one with its ID and hands back the previous version; when the ID is
+    // unknown nothing changes, item is left untouched and the result is empty
+    virtual std::optional<T> replace(T&& item) = 0;
+
+    // Partial update: change edits the stored item in place, touching only the fields flagged in
+    // changedFields, then observers get onPatched. Returns false when the ID is unknown.
+    virtual bool patch(int id, std::uint32_t changedFields, const std::function<void(T&)>& change) = 0;
+
+    // Batch operations apply every item and persist only once
+    virtual void addBatch(const std::vector<T>& items) = 0;
+    virtual void removeBatch(const std::vector<int>& ids) = 0;
+
+    // Visits every item in storage order without copying the collection
+    virtual void forEach(const std::function<void(const T&)>& visitor) const = 0;
+
+    // Returns the stored item, or nullptr; the pointer is invalidated by the next change
+    virtual const T* findById(int id) const = 0;
+
+    // Positional access in storage order, for views that read rows lazily
+    virtual std::size_t count() const = 0;
+    virtual const T& at(std::size_t position) const = 0;
+    // Storage position of the item with this ID, or -1; O(1)
+    virtual int positionOf(int id) const = 0;
+
+    // Reserves an ID no stored item uses, reusing freed IDs first; O(1) amortised
+    virtual int nextId() = 0;
+
+    // Estimated bytes for the stored items, their string and list data, and the lookup indexes
+    virtual MemoryUsage memoryUsage() const = 0;
+
+    // Advances on every stored change, so a result tagged with the generation it was computed at
+    // goes stale in O(1) after any write. Safe to read from any thread.
+    std::uint64_t generation() const {
+        return m_generation.load(std::memory_order_acquire);
+    }
+
+    void addObserver(RepositoryObserver<T>* observer) {
+        m_observers.push_back(observer);
+    }
+
+    void removeObserver(RepositoryObserver<T>* observer) {
+        m_observers.erase(std::remove(m_observers.begin(), m_observers.end(), observer), m_observers.end());
+    }
+
+protected:
+    // Every notify* helper below follows a stored change, so each advances the generation first
+    void advanceGeneration() {
+        m_generation.fetch_add(1, std::memory_order_release);
+    }
+
+    void notifyAdded(const T& item) {
+        advanceGeneration();
+        for (auto* observer : m_observers) {
+            observer->onAdded(item);
+        }
+    }
+
+    void notifyRemoved(const T& item) {
+        advanceGeneration();
+        for (auto* observer : m_observers) {
+            observer->onRemoved(item);
+        }
+    }
+
+    void notifyUpdated(const T& oldItem, const T& newItem) {
+        advanceGeneration();
+        for (auto* observer : m_observers) {
+            observer->onUpdated(oldItem, newItem);
+        }
+    }
+
+    void notifyPatched(const T& oldItem, const T& newItem, std::uint32_t changedFields) {
+        advanceGeneration();
+        for (auto* observer : m_observers) {
+            observer->onPatched(oldItem, newItem, changedFields);
+        }
+    }
+
+    void notifyBatchCommitted(std::size_t changeCount) {
+        for (auto* observer : m_observers) {
+            observer->onBatchCommitted(changeCount);
+        }
+    }
+
+private:
+    std::vector<RepositoryObserver<T>*> m_observers;
+    std::atomic<std::uint64_t> m_generation{0};
 };
 
-#endif // BASEREPOSITORY_H
\ No newline at end of file
+#endif // BASEREPOSITORY_H
@@ -0,0 +1,96 @@
+#ifndef DELIMITEDLINECODEC_H
+#define DELIMITEDLINECODEC_H
+
+#include <QDebug>
+#include <QStringList>
+#include <QTextStream>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "EntitySchema.h"
+
+// Codec policy for FileRepository: one item per line, fields in schema order separated by commas.
+// A QList<int> field may only come last and spreads its elements over the remaining columns.
+// Text is stored as-is, so it must not contain commas or line breaks.
+struct DelimitedLineCodec {
+    template <typename T>
+    static void write(QTextStream& out, const T& item) {
+        std::size_t column = 0;
+        std::apply([&](const auto&... fields) { (writeField(out, (item.*fields.get)(), column++), ...); },
+                   EntitySchema<T>::fields);
+        out << "\n";
+    }
+
+    // Parses one line; empty when the column count does not fit the schema
+    template <typename T>
+    static std::optional<T> read(const QString& line) {
+        constexpr std::size_t fieldCount = std::tuple_size_v<Fields<T>>;
+        constexpr bool trailingList = std::is_same_v<FieldType<T, fieldCount - 1>, QList<int>>;
+        constexpr qsizetype fixedColumns = trailingList ? fieldCount - 1 : fieldCount;
+        const QStringList parts = line.split(',');
+        if (trailingList ? parts.size() < fixedColumns : parts.size() != fixedColumns) {
+            return std::nullopt;
+        }
+        return readFields<T>(parts, std::make_index_sequence<fieldCount>());
+    }
+
+private:
+    template <typename T>
+    using Fields = std::decay_t<decltype(EntitySchema<T>::fields)>;
+
+    template <typename T, std::size_t I>
+    using FieldType = typename std::tuple_element_t<I, Fields<T>>::Type;
+
+    template <typename T, std::size_t... I>
+    static T readFields(const QStringList& parts, std::index_sequence<I...>) {
+        static_assert(((std::is_same_v<FieldType<T, I>, QList<int>> ? I + 1 == sizeof...(I) : true) && ...),
+                      "A list field must be the last field of the schema");
+        return EntitySchema<T>::make(readField<FieldType<T, I>>(parts, static_cast<qsizetype>(I))...);
+    }
+
+    template <typename V>
+    static V readField(const QStringList& parts, qsizetype column) {
+        if constexpr (std::is_same_v<V, int>) {
+            return parts[column].toInt();
+        } else if constexpr (std::is_same_v<V, QString>) {
+            return parts[column];
+        } else if constexpr (std::is_same_v<V, QDate>) {
+            return QDate::fromString(parts[column], Qt::ISODate); // "yyyy-MM-dd"
+        } else {
+            static_assert(std::is_same_v<V, QList<int>>, "Unsupported field type for DelimitedLineCodec");
+            QList<int> values;
+            values.reserve(parts.size() - column);
+            for (qsizetype i = column; i < parts.size(); ++i) {
+                bool ok;
+                int value = parts[i].toInt(&ok);
+                if (ok) {
+                    values.append(value);
+                } else {
+                    qWarning() << "Invalid ID in list column:" << parts[i];
+                }
+            }
+            return values;
+        }
+    }
+
+    template <typename V>
+    static void writeField(QTextStream& out, const V& value, std::size_t column) {
+        if constexpr (std::is_same_v<V, QList<int>>) {
+            for (int element : value) {
+                out << "," << element;
+            }
+        } else {
+            if (column > 0) {
+                out << ",";
+            }
+            if constexpr (std::is_same_v<V, QDate>) {
+                out << value.toString(Qt::ISODate);
+            } else {
+                out << value;
+            }
+        }
+    }
+};
+
+#endif // DELIMITEDLINECODEC_H
@@ -0,0 +1,67 @@
+#ifndef ENTITYSCHEMA_H
+#define ENTITYSCHEMA_H
+
+#include <QDate>
+#include <QList>
+#include <QString>
+#include <tuple>
+#include <utility>
+#include "../Model/Volunteer.h"
+#include "../Model/Event.h"
+
+// A stored column: its name and the getter that reads it
+template <typename T, typename Value>
+struct Field {
+    using Entity = T;
+    using Type = Value;
+    const char* name;
+    Value (T::*get)() const;
+};
+
+template <typename T, typename Value>
+constexpr Field<T, Value> field(const char* name, Value (T::*get)() const) {
+    return {name, get};
+}
+
+// Compile-time description of how a model is stored. Each specialisation lists its fields in
+// file order and a make() that builds the model from one value per field, in the same order;
+// the decoded values are moved in.
+// Codecs walk the tuple with a fold expression, so there is no per-field virtual dispatch.
+template <typename T>
+struct EntitySchema;
+
+template <>
+struct EntitySchema<Volunteer> {
+    static constexpr const char* typeName = "Volunteer"; // Class-name part of trace spans, e.g. CSVVolunteerRepository
+    static constexpr const char* singular = "volunteer";
+    static constexpr const char* plural = "volunteers";
+
+    static constexpr auto fields = std::make_tuple(
+        field("id", &Volunteer::getId),
+        field("name", &Volunteer::getName),
+        field("contactInfo", &Volunteer::getContactInfo));
+
+    static Volunteer make(int id, QString name, QString contactInfo) {
+        return Volunteer(id, std::move(name), std::move(contactInfo));
+    }
+};
+
+template <>
+struct EntitySchema<Event> {
+    static constexpr const char* typeName = "Event";
+    static constexpr const char* singular = "event";
+    static constexpr const char* plural = "events";
+
+    static constexpr auto fields = std::make_tuple(
+        field("id", &Event::getId),
+        field("title", &Event::getTitle),
+        field("date", &Event::getDate),
+        field("location", &Event::getLocation),
+        field("volunteerIds", &Event::getVolunteerIds));
+
+    static Event make(int id, QString title, QDate date, QString location, QList<int> volunteerIds) {
+        return Event(id, std::move(title), date, std::move(location), std::move(volunteerIds));
+    }
+};
+
+#endif // ENTITYSCHEMA_H
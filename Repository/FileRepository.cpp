@@ -0,0 +1,7 @@
+#include "FileRepository.h"
+
+// The four stored combinations are instantiated here once instead of in every including file
+template class FileRepository<Volunteer, CsvFormat>;
+template class FileRepository<Event, CsvFormat>;
+template class FileRepository<Volunteer, JsonFormat>;
+template class FileRepository<Event, JsonFormat>;
@@ -0,0 +1,329 @@
+#ifndef FILEREPOSITORY_H
+#define FILEREPOSITORY_H
+
+#include "BaseRepository.h"
+#include "IdAllocator.h"
+#include "EntitySchema.h"
+#include "DelimitedLineCodec.h"
+#include "../core/Metrics/Metrics.h"
+#include "../core/Trace/Trace.h"
+#include <QByteArray>
+#include <QFile>
+#include <QTextStream>
+#include <QStringList>
+#include <vector>
+#include <algorithm>
+#include <QDebug>
+#include <QSet>
+#include <QHash>
+#include <optional>
+#include <utility>
+
+// File formats: the codec that reads and writes one item, plus the names used in logs,
+// metrics ("repository.csv_events.save") and trace spans ("CSVEventRepository::save")
+struct CsvFormat {
+    using Codec = DelimitedLineCodec;
+    static constexpr const char* key = "csv";
+    static constexpr const char* label = "CSV";
+};
+
+struct JsonFormat {
+    using Codec = DelimitedLineCodec; // .json files have always held delimited lines; kept so existing data loads
+    static constexpr const char* key = "json";
+    static constexpr const char* label = "JSON";
+};
+
+// Builds the metric and span names for one operation once per call site
+#define FILE_REPOSITORY_SCOPE(category, metricOp, spanOp) \
+    METRIC_LATENCY(metricName(metricOp)); \
+    TRACE_SCOPE(category, [] { static const QByteArray span = spanName(spanOp); return span.constData(); }())
+
+// File-backed repository for any model with an EntitySchema, stored through Format::Codec.
+// The whole file is loaded on construction and rewritten after every change.
+template <typename T, typename Format>
+class FileRepository : public BaseRepository<T> {
+public:
+    using Schema = EntitySchema<T>;
+    using Codec = typename Format::Codec;
+
+    FileRepository(const QString& filename) : m_filename(filename) {
+        load();
+    }
+    ~FileRepository() override = default;
+
+    // Adds a new item and saves changes
+    void add(const T& item) override {
+        FILE_REPOSITORY_SCOPE("repository", "add", "add");
+        addItem(item);
+    }
+
+    void add(T&& item) override {
+        FILE_REPOSITORY_SCOPE("repository", "add", "add");
+        addItem(std::move(item));
+    }
+
+    // Removes an item by ID and saves changes
+    void remove(int id) override {
+        FILE_REPOSITORY_SCOPE("repository", "remove", "remove");
+        takeItem(id);
+    }
+
+    std::optional<T> take(int id) override {
+        FILE_REPOSITORY_SCOPE("repository", "take", "take");
+        return takeItem(id);
+    }
+
+    // Replaces the stored item with the same ID and saves changes
+    void update(const T& item) override {
+        FILE_REPOSITORY_SCOPE("repository", "update", "update");
+        replaceItem(item);
+    }
+
+    void update(T&& item) override {
+        FILE_REPOSITORY_SCOPE("repository", "update", "update");
+        replaceItem(std::move(item));
+    }
+
+    std::optional<T> replace(T&& item) override {
+        FILE_REPOSITORY_SCOPE("repository", "replace", "replace");
+        return replaceItem(std::move(item));
+    }
+
+    std::vector<T> getAll() const override {
+        return m_items;
+    }
+
+    // The copy kept for observers shares its string and list data with the stored item, and change
+    // only replaces the fields it patches, so untouched fields are never copied
+    bool patch(int id, std::uint32_t changedFields, const std::function<void(T&)>& change) override {
+        FILE_REPOSITORY_SCOPE("repository", "patch", "patch");
+        auto pos = m_indexById.constFind(id);
+        if (pos == m_indexById.constEnd()) {
+            qWarning() << Schema::typeName << "with ID" << id << "not found for update.";
+            return false;
+        }
+        T& stored = m_items[*pos];
+        const T oldItem = stored;
+        change(stored);
+        save(); // Persist changes to file
+        this->notifyPatched(oldItem, stored, changedFields);
+        qDebug() << Schema::typeName << "with ID" << id << "patched.";
+        return true;
+    }
+
+    // Adds several items, skipping duplicate IDs, and saves once
+    void addBatch(const std::vector<T>& items) override {
+        FILE_REPOSITORY_SCOPE("repository", "add_batch", "addBatch");
+        m_items.reserve(m_items.size() + items.size());
+        std::size_t added = 0;
+        for (const auto& item : items) {
+            if (m_indexById.contains(item.getId())) {
+                qWarning() << Schema::typeName << "with ID" << item.getId() << "already exists. Skipping.";
+                continue;
+            }
+            m_items.push_back(item);
+            m_indexById.insert(item.getId(), m_items.size() - 1);
+            m_ids.reserve(item.getId());
+            ++added;
+        }
+        save();
+        for (std::size_t i = m_items.size() - added; i < m_items.size(); ++i) {
+            this->notifyAdded(m_items[i]);
+        }
+        this->notifyBatchCommitted(added);
+        qDebug() << "Batch added" << added << Schema::plural;
+    }
+
+    // Removes several items by ID and saves once
+    void removeBatch(const std::vector<int>& ids) override {
+        FILE_REPOSITORY_SCOPE("repository", "remove_batch", "removeBatch");
+        const QSet<int> toRemove(ids.begin(), ids.end());
+        // Stable partition keeps the survivors in order and the removed items intact for observers
+        auto it = std::stable_partition(m_items.begin(), m_items.end(),
+                                        [&toRemove](const T& item) { return !toRemove.contains(item.getId()); });
+        std::vector<T> removedItems(std::make_move_iterator(it), std::make_move_iterator(m_items.end()));
+        m_items.erase(it, m_items.end());
+        rebuildIndex();
+        for (const auto& item : removedItems) {
+            m_ids.release(item.getId());
+        }
+        save();
+        for (const auto& item : removedItems) {
+            this->notifyRemoved(item);
+        }
+        this->notifyBatchCommitted(removedItems.size());
+        qDebug() << "Batch removed" << removedItems.size() << Schema::plural;
+    }
+
+    // Visits stored items in place, without the copy getAll() makes
+    void forEach(const std::function<void(const T&)>& visitor) const override {
+        for (const auto& item : m_items) {
+            visitor(item);
+        }
+    }
+
+    // Looks up an item by ID in constant time; the pointer is valid until the next change
+    const T* findById(int id) const override {
+        auto pos = m_indexById.constFind(id);
+        return pos != m_indexById.constEnd() ? &m_items[*pos] : nullptr;
+    }
+
+    std::size_t count() const override {
+        return m_items.size();
+    }
+
+    // Item at a storage position; the caller keeps position < count()
+    const T& at(std::size_t position) const override {
+        return m_items[position];
+    }
+
+    // Storage position of an ID through the index, or -1 when absent
+    int positionOf(int id) const override {
+        auto pos = m_indexById.constFind(id);
+        return pos != m_indexById.constEnd() ? static_cast<int>(*pos) : -1;
+    }
+
+    // Reserves an unused ID from the allocator; no scan over stored items
+    int nextId() override {
+        return m_ids.allocate();
+    }
+
+    // Estimated memory held by the stored items and indexes
+    MemoryUsage memoryUsage() const override {
+        MemoryUsage usage;
+        addVectorUsage(usage, m_items);
+        usage.indexBytes += hashHeapBytes(m_indexById) + m_ids.memoryBytes();
+        return usage;
+    }
+
+private:
+    QString m_filename;
+    std::vector<T> m_items; // In-memory storage
+    QHash<int, std::size_t> m_indexById; // ID -> position in m_items
+    IdAllocator m_ids; // Persisted next to the data file as <filename>.ids
+
+    static QString metricName(const char* op) {
+        return QStringLiteral("repository.%1_%2.%3")
+            .arg(QLatin1String(Format::key), QLatin1String(Schema::plural), QLatin1String(op));
+    }
+
+    static QByteArray spanName(const char* op) {
+        return QByteArray(Format::label) + Schema::typeName + "Repository::" + op;
+    }
+
+    // Shared by the copying and moving overloads; U is const T& or T
+    template <typename U>
+    void addItem(U&& item) {
+        // Basic validation: check if ID already exists
+        if (m_indexById.contains(item.getId())) {
+            qWarning() << Schema::typeName << "with ID" << item.getId() << "already exists. Cannot add.";
+            return;
+        }
+        m_items.push_back(std::forward<U>(item));
+        const T& stored = m_items.back();
+        m_indexById.insert(stored.getId(), m_items.size() - 1);
+        m_ids.reserve(stored.getId());
+        save(); // Persist changes to file
+        this->notifyAdded(stored);
+        qDebug() << Schema::typeName << "with ID" << stored.getId() << "added.";
+    }
+
+    std::optional<T> takeItem(int id) {
+        auto pos = m_indexById.constFind(id);
+        if (pos == m_indexById.constEnd()) {
+            qWarning() << Schema::typeName << "with ID" << id << "not found for removal.";
+            return std::nullopt;
+        }
+        std::optional<T> removed(std::move(m_items[*pos]));
+        m_items.erase(m_items.begin() + static_cast<std::ptrdiff_t>(*pos));
+        m_ids.release(id);
+        rebuildIndex(); // Positions after the erased item have shifted
+        save(); // Persist changes to file
+        this->notifyRemoved(*removed);
+        qDebug() << Schema::typeName << "with ID" << id << "removed.";
+        return removed;
+    }
+
+    template <typename U>
+    std::optional<T> replaceItem(U&& item) {
+        auto pos = m_indexById.constFind(item.getId());
+        if (pos == m_indexById.constEnd()) {
+            qWarning() << Schema::typeName << "with ID" << item.getId() << "not found for update.";
+            return std::nullopt;
+        }
+        auto& stored = m_items[*pos];
+        std::optional<T> previous(std::move(stored));
+        stored = std::forward<U>(item);
+        save(); // Persist changes to file
+        this->notifyUpdated(*previous, stored);
+        qDebug() << Schema::typeName << "with ID" << stored.getId() << "updated.";
+        return previous;
+    }
+
+    // Loads every line of the file into memory, skipping lines the codec rejects
+    void load() {
+        FILE_REPOSITORY_SCOPE("io", "load", "load");
+        m_items.clear(); // Clear existing data before loading
+        m_indexById.clear();
+        QFile file(m_filename);
+        if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+            qWarning() << "Could not open" << Schema::singular << Format::label << "file for reading:" << m_filename;
+            return;
+        }
+
+        QTextStream in(&file);
+        while (!in.atEnd()) {
+            QString line = in.readLine();
+            if (auto item = Codec::template read<T>(line)) {
+                m_items.push_back(std::move(*item));
+            } else {
+                qWarning() << "Skipping malformed line in" << Schema::singular << Format::label << "file:" << line;
+            }
+        }
+        file.close();
+        rebuildIndex();
+        m_ids.load(m_filename + ".ids");
+        for (const auto& item : m_items) {
+            m_ids.reserve(item.getId()); // Reconciles a missing or stale ID file
+        }
+        qDebug() << "Loaded" << m_items.size() << Schema::plural << "from" << m_filename;
+    }
+
+    // Rewrites the whole file from memory
+    void save() const {
+        FILE_REPOSITORY_SCOPE("io", "save", "save");
+        QFile file(m_filename);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Text | QIODevice::Truncate)) {
+            METRIC_COUNT("repository.save_failures");
+            qWarning() << "Could not open" << Schema::singular << Format::label << "file for writing:" << m_filename;
+            return;
+        }
+
+        QTextStream out(&file);
+        for (const auto& item : m_items) {
+            Codec::write(out, item);
+        }
+        file.close();
+        m_ids.save(m_filename + ".ids");
+        qDebug() << "Saved" << m_items.size() << Schema::plural << "to" << m_filename;
+    }
+
+    // Recomputes the ID -> position map after items were erased from the middle
+    void rebuildIndex() {
+        m_indexById.clear();
+        m_indexById.reserve(static_cast<qsizetype>(m_items.size()));
+        for (std::size_t i = 0; i < m_items.size(); ++i) {
+            m_indexById.insert(m_items[i].getId(), i);
+        }
+    }
+};
+
+#undef FILE_REPOSITORY_SCOPE
+
+// Compiled once in FileRepository.cpp
+extern template class FileRepository<Volunteer, CsvFormat>;
+extern template class FileRepository<Event, CsvFormat>;
+extern template class FileRepository<Volunteer, JsonFormat>;
+extern template class FileRepository<Event, JsonFormat>;
+
+#endif // FILEREPOSITORY_H
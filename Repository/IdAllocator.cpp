@@ -0,0 +1,73 @@
+#include "IdAllocator.h"
+#include <QFile>
+#include <QTextStream>
+#include <QStringList>
+#include <QDebug>
+#include <algorithm>
+
+int IdAllocator::allocate() {
+    if (!m_free.empty()) {
+        int id = *m_free.begin();
+        m_free.erase(m_free.begin());
+        return id;
+    }
+    return ++m_highWaterMark;
+}
+
+void IdAllocator::reserve(int id) {
+    if (id > m_highWaterMark) {
+        // IDs skipped over are not tracked; they are simply never handed out
+        m_highWaterMark = id;
+    } else {
+        m_free.erase(id);
+    }
+}
+
+void IdAllocator::release(int id) {
+    if (id > 0 && id <= m_highWaterMark) {
+        m_free.insert(id);
+    }
+}
+
+void IdAllocator::clear() {
+    m_highWaterMark = 0;
+    m_free.clear();
+}
+
+void IdAllocator::load(const QString& filename) {
+    clear();
+    QFile file(filename);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        return; // No sidecar yet: the repository reserves its stored IDs after loading
+    }
+
+    QTextStream in(&file);
+    m_highWaterMark = std::max(0, in.readLine().toInt());
+    const QStringList freeIds = in.readLine().split(',', Qt::SkipEmptyParts);
+    for (const QString& part : freeIds) {
+        bool ok;
+        int id = part.toInt(&ok);
+        if (ok) {
+            release(id);
+        } else {
+            qWarning() << "Invalid free ID in" << filename << ":" << part;
+        }
+    }
+}
+
+void IdAllocator::save(const QString& filename) const {
+    QFile file(filename);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text | QIODevice::Truncate)) {
+        qWarning() << "Could not open ID file for writing:" << filename;
+        return;
+    }
+
+    QTextStream out(&file);
+    out << m_highWaterMark << "\n";
+    bool first = true;
+    for (int id : m_free) {
+        out << (first ? "" : ",") << id;
+        first = false;
+    }
+    out << "\n";
+}
@@ -0,0 +1,34 @@
+#ifndef IDALLOCATOR_H
+#define IDALLOCATOR_H
+
+#include <QString>
+#include <set>
+
+// Hands out unused positive IDs without scanning the stored items.
+// Freed IDs are reused lowest first; otherwise the high-water mark grows.
+// Undo/redo replays changes in reverse order, so a reused ID is always free again
+// before the item that originally owned it is restored.
+class IdAllocator {
+public:
+    // Returns an ID no stored item uses; it counts as taken until released
+    int allocate();
+    // Marks an ID as in use, e.g. when an item is added with an explicit ID
+    void reserve(int id);
+    // Returns an ID to the free list once its item is removed
+    void release(int id);
+    void clear();
+
+    int highWaterMark() const { return m_highWaterMark; }
+    // Estimated heap held by the free list: one tree node per freed ID
+    std::size_t memoryBytes() const { return m_free.size() * (sizeof(int) + 4 * sizeof(void*)); }
+
+    // Sidecar persistence: the high-water mark on the first line, free IDs on the second
+    void load(const QString& filename);
+    void save(const QString& filename) const;
+
+private:
+    int m_highWaterMark = 0;
+    std::set<int> m_free;
+};
+
+#endif // IDALLOCATOR_H
@@ -1,31 +1,9 @@
 #ifndef JSONVOLUNTEERREPOSITORY_H
 #define JSONVOLUNTEERREPOSITORY_H
 
-#include "../BaseRepository.h"
-#include "../../Model/Volunteer.h"
-#include <QFile>
-#include <QTextStream>
-#include <QString>
-#include <vector>
-#include <algorithm>
-#include <QDebug>
+#include "../FileRepository.h"
 
-class JSONVolunteerRepository : public BaseRepository<Volunteer> {
-public:
-    JSONVolunteerRepository(const QString& filename);
-    ~JSONVolunteerRepository() override = default;
+// Volunteers in a .json file, in the same line layout as CSVVolunteerRepository
+using JSONVolunteerRepository = FileRepository<Volunteer, JsonFormat>;
 
-    void add(const Volunteer& volunteer) override;
-    void remove(int id) override;
-    void update(const Volunteer& volunteer) override;
-    std::vector<Volunteer> getAll() const override;
-
-private:
-    QString m_filename;
-    std::vector<Volunteer> m_volunteers;
-
-    void load();
-    void save() const;
-};
-
-#endif // JSONVOLUNTEERREPOSITORY_H
\ No newline at end of file
+#endif // JSONVOLUNTEERREPOSITORY_H
@@ -0,0 +1,29 @@
+#ifndef REPOSITORYOBSERVER_H
+#define REPOSITORYOBSERVER_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Receives every change applied to a repository, after the change is stored.
+// Commands and undo/redo all go through the repository, so observers stay in sync with both.
+template <typename T>
+class RepositoryObserver {
+public:
+    virtual ~RepositoryObserver() = default;
+
+    virtual void onAdded(const T& item) = 0;
+    virtual void onRemoved(const T& item) = 0;
+    virtual void onUpdated(const T& oldItem, const T& newItem) = 0;
+
+    // Called instead of onUpdated after a partial update; changedFields holds the model's field flags
+    // (EventField for events). Observers override it to skip work for fields they do not depend on.
+    virtual void onPatched(const T& oldItem, const T& newItem, std::uint32_t changedFields) {
+        (void)changedFields;
+        onUpdated(oldItem, newItem);
+    }
+
+    // Called once after addBatch/removeBatch, following the per-item notifications
+    virtual void onBatchCommitted(std::size_t changeCount) { (void)changeCount; }
+};
+
+#endif // REPOSITORYOBSERVER_H
@@ -0,0 +1,103 @@
+#include "BenchmarkHarness.h"
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QDateTime>
+#include <QSysInfo>
+#include <QTextStream>
+#include <QDebug>
+#include <algorithm>
+#include <numeric>
+#include <cstdio>
+
+double BenchmarkResult::opsPerSecond() const {
+    return medianNs > 0 ? static_cast<double>(opsPerIteration) * 1e9 / static_cast<double>(medianNs) : 0.0;
+}
+
+BenchmarkHarness::BenchmarkHarness(const QString& filter)
+    : m_filter(filter) {
+}
+
+bool BenchmarkHarness::shouldRun(const QString& name) const {
+    return m_filter.isEmpty() || name.contains(m_filter);
+}
+
+void BenchmarkHarness::run(const QString& name, qint64 rows, int iterations,
+                           const std::function<void()>& setup, const std::function<void()>& body,
+                           qint64 opsPerIteration) {
+    if (!shouldRun(name) || iterations <= 0) {
+        return;
+    }
+
+    std::vector<qint64> samples;
+    samples.reserve(static_cast<std::size_t>(iterations));
+    QElapsedTimer timer;
+    for (int i = 0; i < iterations; ++i) {
+        if (setup) {
+            setup();
+        }
+        timer.start();
+        body();
+        samples.push_back(timer.nsecsElapsed());
+    }
+
+    std::sort(samples.begin(), samples.end());
+    BenchmarkResult result;
+    result.name = name;
+    result.rows = rows;
+    result.iterations = iterations;
+    result.opsPerIteration = opsPerIteration;
+    result.minNs = samples.front();
+    result.maxNs = samples.back();
+    result.medianNs = samples[samples.size() / 2];
+    result.meanNs = std::accumulate(samples.begin(), samples.end(), qint64(0)) / static_cast<qint64>(samples.size());
+    m_results.push_back(result);
+
+    // Progress goes to stderr so stdout stays valid JSON
+    std::fprintf(stderr, "%-40s rows=%-8lld median=%10.3f ms\n", qPrintable(name), static_cast<long long>(rows),
+                 static_cast<double>(result.medianNs) / 1e6);
+}
+
+QJsonDocument BenchmarkHarness::toJson(const QString& suite) const {
+    QJsonArray results;
+    for (const auto& result : m_results) {
+        QJsonObject entry;
+        entry["name"] = result.name;
+        entry["rows"] = result.rows;
+        entry["iterations"] = result.iterations;
+        entry["ops_per_iteration"] = result.opsPerIteration;
+        entry["min_ns"] = result.minNs;
+        entry["median_ns"] = result.medianNs;
+        entry["mean_ns"] = result.meanNs;
+        entry["max_ns"] = result.maxNs;
+        entry["ops_per_second"] = result.opsPerSecond();
+        results.append(entry);
+    }
+
+    QJsonObject root;
+    root["suite"] = suite;
+    root["timestamp"] = QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
+    root["qt_version"] = QString(qVersion());
+    root["host"] = QSysInfo::machineHostName();
+    root["cpu_architecture"] = QSysInfo::currentCpuArchitecture();
+    root["results"] = results;
+    return QJsonDocument(root);
+}
+
+bool BenchmarkHarness::writeJson(const QString& suite, const QString& path) const {
+    const QByteArray json = toJson(suite).toJson(QJsonDocument::Indented);
+    if (path == "-") {
+        QTextStream out(stdout);
+        out << json;
+        return true;
+    }
+
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qWarning() << "Could not open benchmark output file for writing:" << path;
+        return false;
+    }
+    file.write(json);
+    return true;
+}
@@ -0,0 +1,48 @@
+#ifndef BENCHMARKHARNESS_H
+#define BENCHMARKHARNESS_H
+
+#include <QString>
+#include <QJsonDocument>
+#include <functional>
+#include <vector>
+
+// Timing of one benchmark case; all durations are wall-clock nanoseconds per iteration
+struct BenchmarkResult {
+    QString name;
+    qint64 rows = 0;             // Dataset size the case ran against
+    int iterations = 0;
+    qint64 opsPerIteration = 1;  // Operations timed per iteration, for throughput
+    qint64 minNs = 0;
+    qint64 medianNs = 0;
+    qint64 meanNs = 0;
+    qint64 maxNs = 0;
+
+    double opsPerSecond() const;
+};
+
+// Minimal benchmark runner with JSON output. QtTest's QBENCHMARK has no JSON logger,
+// so cases are timed here with QElapsedTimer and reported in a stable schema.
+class BenchmarkHarness {
+public:
+    // Only cases whose name contains filter run; an empty filter runs everything
+    explicit BenchmarkHarness(const QString& filter = QString());
+
+    bool shouldRun(const QString& name) const;
+
+    // Calls setup (untimed) and then body (timed) once per iteration
+    void run(const QString& name, qint64 rows, int iterations,
+             const std::function<void()>& setup, const std::function<void()>& body,
+             qint64 opsPerIteration = 1);
+
+    const std::vector<BenchmarkResult>& results() const { return m_results; }
+
+    QJsonDocument toJson(const QString& suite) const;
+    // "-" writes to stdout
+    bool writeJson(const QString& suite, const QString& path) const;
+
+private:
+    QString m_filter;
+    std::vector<BenchmarkResult> m_results;
+};
+
+#endif // BENCHMARKHARNESS_H
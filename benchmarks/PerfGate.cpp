@@ -0,0 +1,84 @@
+#include "PerfGate.h"
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <QDebug>
+#include <cmath>
+#include <cstdio>
+
+bool PerfGate::loadBaseline(const QString& filename) {
+    QFile file(filename);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "Could not open performance baseline:" << filename;
+        return false;
+    }
+    QJsonParseError error;
+    const QJsonDocument document = QJsonDocument::fromJson(file.readAll(), &error);
+    if (error.error != QJsonParseError::NoError || !document.isObject()) {
+        qWarning() << "Invalid performance baseline" << filename << ":" << error.errorString();
+        return false;
+    }
+
+    const QJsonObject root = document.object();
+    m_tolerance = root.value("tolerance").toDouble(0.25);
+    m_budgetsMs.clear();
+    const QJsonObject budgets = root.value("budgets_ms").toObject();
+    for (auto it = budgets.constBegin(); it != budgets.constEnd(); ++it) {
+        m_budgetsMs.insert(it.key(), it.value().toDouble());
+    }
+    return true;
+}
+
+bool PerfGate::check(const BenchmarkHarness& harness) const {
+    bool passed = true;
+    for (auto it = m_budgetsMs.constBegin(); it != m_budgetsMs.constEnd(); ++it) {
+        if (!harness.shouldRun(it.key())) {
+            continue;
+        }
+        const BenchmarkResult* measured = nullptr;
+        for (const BenchmarkResult& result : harness.results()) {
+            if (result.name == it.key()) {
+                measured = &result;
+            }
+        }
+        const double limitMs = it.value() * (1.0 + m_tolerance);
+        if (!measured) {
+            std::fprintf(stderr, "FAIL %-30s did not run (missing dataset?)\n", qPrintable(it.key()));
+            passed = false;
+            continue;
+        }
+        const double medianMs = static_cast<double>(measured->medianNs) / 1e6;
+        const bool ok = medianMs <= limitMs;
+        std::fprintf(stderr, "%s %-30s median %10.1f ms, budget %10.1f ms (limit %10.1f ms, %+.0f%%)\n",
+                     ok ? "PASS" : "FAIL", qPrintable(it.key()), medianMs, it.value(), limitMs,
+                     it.value() > 0 ? (medianMs / it.value() - 1.0) * 100.0 : 0.0);
+        passed = passed && ok;
+    }
+    return passed;
+}
+
+bool PerfGate::writeBaseline(const QString& filename, const BenchmarkHarness& harness) const {
+    QJsonObject root;
+    QFile existing(filename);
+    if (existing.open(QIODevice::ReadOnly)) {
+        root = QJsonDocument::fromJson(existing.readAll()).object();
+        existing.close();
+    }
+    if (!root.contains("tolerance")) {
+        root.insert("tolerance", m_tolerance);
+    }
+    QJsonObject budgets = root.value("budgets_ms").toObject();
+    for (const BenchmarkResult& result : harness.results()) {
+        budgets.insert(result.name, std::ceil(static_cast<double>(result.medianNs) / 1e6));
+    }
+    root.insert("budgets_ms", budgets);
+
+    QSaveFile file(filename);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "Could not open performance baseline for writing:" << filename;
+        return false;
+    }
+    file.write(QJsonDocument(root).toJson(QJsonDocument::Indented));
+    return file.commit();
+}
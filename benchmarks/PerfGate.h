@@ -0,0 +1,26 @@
+#ifndef PERFGATE_H
+#define PERFGATE_H
+
+#include "BenchmarkHarness.h"
+#include <QMap>
+#include <QString>
+#include <vector>
+
+// Checked-in latency budgets for the CTest performance gate. A scenario fails when its median
+// exceeds budget * (1 + tolerance); a budgeted scenario that did not run also fails.
+class PerfGate {
+public:
+    bool loadBaseline(const QString& filename);
+    // Logs one line per budgeted scenario selected by harness's filter; false on any failure
+    bool check(const BenchmarkHarness& harness) const;
+    // Records the measured medians as the new budgets, keeping the tolerance and other entries
+    bool writeBaseline(const QString& filename, const BenchmarkHarness& harness) const;
+
+    double tolerance() const { return m_tolerance; }
+
+private:
+    double m_tolerance = 0.25;
+    QMap<QString, double> m_budgetsMs;
+};
+
+#endif // PERFGATE_H
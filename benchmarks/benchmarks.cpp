@@ -0,0 +1,357 @@
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QTemporaryDir>
+#include <QFile>
+#include <QTextStream>
+#include <QDate>
+#include <QDebug>
+#include <QDir>
+#include <QFileInfo>
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include <cstdio>
+
+#include "BenchmarkHarness.h"
+#include "PerfGate.h"
+#include "../Controller/Controller.h"
+#include "../Repository/CSV/CSVVolunteerRepository.h"
+#include "../Repository/CSV/CSVEventRepository.h"
+#include "../ui/EventListModel.h"
+#include "../core/Query/Query.h"
+
+namespace {
+
+const QStringList kLocations = {"Central Park", "Library", "Community Center", "Riverside", "Town Hall",
+                                "Harbor", "Old Market", "Stadium", "School Yard", "Museum"};
+
+// Repositories log every operation; keep warnings, drop the per-row chatter
+void quietMessageHandler(QtMsgType type, const QMessageLogContext&, const QString& message) {
+    if (type == QtDebugMsg || type == QtInfoMsg) {
+        return;
+    }
+    std::fprintf(stderr, "%s\n", qPrintable(message));
+}
+
+Volunteer makeVolunteer(int id) {
+    return Volunteer(id, QString("Volunteer %1").arg(id), QString("volunteer%1@example.com").arg(id));
+}
+
+Event makeEvent(int id, int volunteerCount) {
+    Event event(id, QString("Event %1").arg(id), QDate(2020, 1, 1).addDays(id % 1500), kLocations[id % kLocations.size()]);
+    for (int k = 0; k < id % 4; ++k) {
+        event.addVolunteer(1 + (id * 7 + k * 13) % volunteerCount);
+    }
+    return event;
+}
+
+bool writeVolunteerCsv(const QString& path, int rows) {
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text | QIODevice::Truncate)) {
+        qWarning() << "Could not open volunteer file for writing:" << path;
+        return false;
+    }
+    QTextStream out(&file);
+    for (int id = 1; id <= rows; ++id) {
+        const Volunteer v = makeVolunteer(id);
+        out << v.getId() << "," << v.getName() << "," << v.getContactInfo() << "\n";
+    }
+    return true;
+}
+
+bool writeEventCsv(const QString& path, int rows, int volunteerCount) {
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text | QIODevice::Truncate)) {
+        qWarning() << "Could not open event file for writing:" << path;
+        return false;
+    }
+    QTextStream out(&file);
+    for (int id = 1; id <= rows; ++id) {
+        const Event e = makeEvent(id, volunteerCount);
+        out << e.getId() << "," << e.getTitle() << "," << e.getDate().toString(Qt::ISODate) << "," << e.getLocation();
+        for (int volunteerId : e.getVolunteerIds()) {
+            out << "," << volunteerId;
+        }
+        out << "\n";
+    }
+    return true;
+}
+
+// Every mutating repository call rewrites the whole file, so per-operation cases are O(rows)
+int iterationsFor(int rows) {
+    return rows <= 1000 ? 20 : rows <= 100000 ? 5 : 1;
+}
+
+// False when the dataset could not be written; the remaining cases are skipped
+bool runSize(BenchmarkHarness& harness, const QString& dir, int rows) {
+    const int volunteerCount = std::max(1, rows / 10);
+    const QString volunteerPath = dir + QString("/volunteers_%1.csv").arg(rows);
+    const QString eventPath = dir + QString("/events_%1.csv").arg(rows);
+    if (!writeVolunteerCsv(volunteerPath, volunteerCount) || !writeEventCsv(eventPath, rows, volunteerCount)) {
+        return false;
+    }
+    const int iterations = iterationsFor(rows);
+
+    // --- Repository load / bulk save ---
+    harness.run("repository/load_events", rows, iterations, nullptr, [&]() {
+        CSVEventRepository repo(eventPath);
+    });
+
+    std::vector<Event> events;
+    if (harness.shouldRun("repository/add_batch_events")) {
+        events.reserve(static_cast<std::size_t>(rows));
+        for (int id = 1; id <= rows; ++id) {
+            events.push_back(makeEvent(id, volunteerCount));
+        }
+    }
+    std::unique_ptr<CSVEventRepository> scratch;
+    const QString scratchPath = dir + "/scratch_events.csv";
+    harness.run("repository/add_batch_events", rows, iterations,
+                [&]() {
+                    scratch.reset();
+                    QFile::remove(scratchPath);
+                    QFile::remove(scratchPath + ".ids");
+                    scratch = std::make_unique<CSVEventRepository>(scratchPath);
+                },
+                [&]() { scratch->addBatch(events); });
+    scratch.reset();
+    events.clear();
+    events.shrink_to_fit();
+
+    // --- Single operations against a loaded repository (each includes the save) ---
+    {
+        CSVEventRepository repo(eventPath);
+        int nextId = rows + 1;
+        harness.run("repository/add_event", rows, iterations, nullptr, [&]() {
+            repo.add(makeEvent(nextId++, volunteerCount));
+        });
+        int updateId = 1;
+        harness.run("repository/update_event", rows, iterations, nullptr, [&]() {
+            Event e = makeEvent(updateId++, volunteerCount);
+            e.setTitle("Renamed");
+            repo.update(e);
+        });
+        int removeId = 1;
+        harness.run("repository/remove_event", rows, iterations, nullptr, [&]() {
+            repo.remove(removeId++);
+        });
+    }
+    if (!writeEventCsv(eventPath, rows, volunteerCount)) { // Restore the file the cases above modified
+        return false;
+    }
+
+    // --- Controller queries ---
+    Controller controller(std::make_unique<CSVVolunteerRepository>(volunteerPath),
+                          std::make_unique<CSVEventRepository>(eventPath));
+
+    harness.run("controller/filter_by_date", rows, iterations, nullptr, [&]() {
+        controller.filterEventsByDate("2021-06-01");
+    });
+    harness.run("controller/filter_by_location", rows, iterations, nullptr, [&]() {
+        controller.filterEventsByLocation("park");
+    });
+    // Repeats one query over unchanged events: every call after the first is a cache hit
+    EventFilter parkFilter;
+    parkFilter.locationContains = "park";
+    harness.run("controller/matching_event_ids_cached", rows, iterations, nullptr, [&]() {
+        controller.matchingEventIds(parkFilter);
+    });
+    harness.run("controller/query_events_page", rows, iterations, nullptr, [&]() {
+        controller.queryEvents(EventFilter(), EventSortKey::Title, 0, 50);
+    });
+    harness.run("controller/upcoming_events", rows, iterations, nullptr, [&]() {
+        controller.upcomingEvents(QDate(2021, 1, 1), 50);
+    });
+
+    // --- Undo/redo throughput: each step is a full repository write ---
+    const int steps = 10;
+    harness.run("controller/undo_redo", rows, std::max(1, iterations / 5),
+                [&]() {
+                    for (int i = 1; i <= steps; ++i) {
+                        Event e = makeEvent(i, volunteerCount);
+                        e.setLocation("Moved");
+                        controller.updateEvent(i, e);
+                    }
+                },
+                [&]() {
+                    for (int i = 0; i < steps; ++i) {
+                        controller.undo();
+                    }
+                    for (int i = 0; i < steps; ++i) {
+                        controller.redo();
+                    }
+                },
+                2 * steps);
+
+    // Partial update of one field; the undo record keeps only that field
+    int patchId = 1;
+    harness.run("controller/update_event_fields", rows, iterations, nullptr, [&]() {
+        EventFieldValues values;
+        values.location = "Moved";
+        controller.updateEventFields(patchId, EventField::Location, std::move(values));
+        patchId = patchId % steps + 1;
+    });
+
+    // The same write with snapshot reads on, then a reader taking the new version: the writer copies
+    // one chunk and republishes the chunk list instead of the whole data set
+    controller.setSnapshotReads(true);
+    harness.run("controller/update_with_snapshot_reads", rows, iterations, nullptr, [&]() {
+        EventFieldValues values;
+        values.location = "Moved again";
+        controller.updateEventFields(patchId, EventField::Location, std::move(values));
+        patchId = patchId % steps + 1;
+        controller.snapshot();
+    });
+    controller.setSnapshotReads(false);
+
+    // --- UI model population: the lazy model formats only what a view asks for ---
+    harness.run("ui/event_model_first_page", rows, iterations, nullptr, [&]() {
+        EventListModel model(&controller);
+        for (int row = 0; row < std::min(50, model.rowCount()); ++row) {
+            model.data(model.index(row), Qt::DisplayRole);
+        }
+    });
+    harness.run("ui/event_model_all_rows", rows, std::max(1, iterations / 5), nullptr, [&]() {
+        EventListModel model(&controller);
+        for (int row = 0; row < model.rowCount(); ++row) {
+            model.data(model.index(row), Qt::DisplayRole);
+        }
+    });
+    return true;
+}
+
+// Copies a datagen dataset (data files and .ids sidecars) so a scenario can modify it
+bool copyDataset(const QString& from, const QString& to) {
+    QDir(to).removeRecursively();
+    QDir().mkpath(to);
+    for (const char* name : {"volunteers.csv", "events.csv", "volunteers.csv.ids", "events.csv.ids"}) {
+        if (QFile::exists(from + "/" + name) && !QFile::copy(from + "/" + name, to + "/" + name)) {
+            return false;
+        }
+    }
+    return QFile::exists(to + "/events.csv");
+}
+
+// Fixed scenarios for the CTest performance gate, run against the datasets the perf_data
+// fixture generates under dataDir: large (1M events), medium (100k) and small (1k).
+// A scenario whose dataset is missing is skipped, which the gate then reports as a failure.
+void runGateScenarios(BenchmarkHarness& harness, const QString& dataDir, const QString& scratchDir) {
+    const QString largeEvents = dataDir + "/large/events.csv";
+    if (QFile::exists(largeEvents)) {
+        harness.run("gate/load_events", 1000000, 3, nullptr, [&]() {
+            CSVEventRepository repo(largeEvents);
+        });
+    }
+
+    // Every update rewrites the event file, so this runs against the small dataset
+    const QString workDir = scratchDir + "/update";
+    std::unique_ptr<Controller> controller;
+    if (harness.shouldRun("gate/update_events") && QFile::exists(dataDir + "/small/events.csv")) {
+        // Skipped on failure, so the gate reports the scenario as not run rather than timing nothing
+        if (copyDataset(dataDir + "/small", workDir)) {
+            controller = std::make_unique<Controller>(
+                std::make_unique<CSVVolunteerRepository>(workDir + "/volunteers.csv"),
+                std::make_unique<CSVEventRepository>(workDir + "/events.csv"));
+        } else {
+            qWarning() << "Could not copy the small dataset to" << workDir << ". Skipping gate/update_events.";
+        }
+    }
+    if (controller && controller->eventCount() == 0) {
+        qWarning() << "The small dataset has no events. Skipping gate/update_events.";
+        controller.reset();
+    }
+    if (controller) {
+        const int eventCount = controller->eventCount();
+        const int updates = 10000;
+        harness.run("gate/update_events", 1000, 1, nullptr,
+                    [&]() {
+                        for (int i = 0; i < updates; ++i) {
+                            Event event = controller->eventAt(i % eventCount);
+                            event.setLocation(i % 2 ? "North Park" : "South Market");
+                            controller->updateEvent(event.getId(), event);
+                        }
+                    },
+                    updates);
+        controller.reset();
+    }
+
+    const QString mediumEvents = dataDir + "/medium/events.csv";
+    if (harness.shouldRun("gate/filter_events") && QFile::exists(mediumEvents)) {
+        const std::vector<Event> events = CSVEventRepository(mediumEvents).getAll();
+        const QStringList needles = {"north", "park", "old town", "market", "lakeside museum", "no such place"};
+        const int filters = 1000;
+        harness.run("gate/filter_events", static_cast<qint64>(events.size()), 3, nullptr, [&]() {
+            for (int i = 0; i < filters; ++i) {
+                EventFilter filter;
+                filter.locationContains = needles[i % needles.size()];
+                filterEventIds(events, filter, nullptr);
+            }
+        }, filters);
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("volunteer_benchmarks");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Repository, controller and model benchmarks with JSON output.");
+    parser.addHelpOption();
+    QCommandLineOption sizesOption("sizes", "Comma-separated dataset sizes.", "rows", "1000,100000,1000000");
+    QCommandLineOption jsonOption("json", "Write results to this file ('-' for stdout).", "path", "-");
+    QCommandLineOption filterOption("filter", "Only run cases whose name contains this text.", "text");
+    QCommandLineOption dataDirOption("data-dir", "Run the gate scenarios against datagen output in this directory.", "dir");
+    QCommandLineOption baselineOption("baseline", "Fail if a gate scenario exceeds its budget in this file.", "file");
+    QCommandLineOption writeBaselineOption("write-baseline", "Store the measured medians as the budgets in --baseline.");
+    parser.addOption(sizesOption);
+    parser.addOption(jsonOption);
+    parser.addOption(filterOption);
+    parser.addOption(dataDirOption);
+    parser.addOption(baselineOption);
+    parser.addOption(writeBaselineOption);
+    parser.process(app);
+
+    qInstallMessageHandler(quietMessageHandler);
+
+    QTemporaryDir dir;
+    if (!dir.isValid()) {
+        qWarning() << "Could not create a temporary directory for benchmark data.";
+        return 1;
+    }
+
+    BenchmarkHarness harness(parser.value(filterOption));
+    if (parser.isSet(dataDirOption)) {
+        runGateScenarios(harness, parser.value(dataDirOption), dir.path());
+    } else {
+        for (const QString& size : parser.value(sizesOption).split(',', Qt::SkipEmptyParts)) {
+            bool ok;
+            int rows = size.trimmed().toInt(&ok);
+            if (!ok || rows <= 0) {
+                qWarning() << "Ignoring invalid size:" << size;
+                continue;
+            }
+            if (!runSize(harness, dir.path(), rows)) {
+                return 1;
+            }
+        }
+    }
+
+    const QString jsonPath = parser.value(jsonOption);
+    if (jsonPath != "-") {
+        QDir().mkpath(QFileInfo(jsonPath).absolutePath());
+    }
+    bool ok = harness.writeJson("volunteer_benchmarks", jsonPath);
+
+    if (parser.isSet(baselineOption)) {
+        PerfGate gate;
+        if (parser.isSet(writeBaselineOption)) {
+            gate.loadBaseline(parser.value(baselineOption)); // Keeps the tolerance; a missing file is fine
+            ok = gate.writeBaseline(parser.value(baselineOption), harness) && ok;
+        } else {
+            ok = gate.loadBaseline(parser.value(baselineOption)) && gate.check(harness) && ok;
+        }
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,114 @@
+#include "EventAggregates.h"
+#include "../Metrics/MemoryUsage.h"
+#include <QSet>
+
+void EventAggregates::rebuild(const BaseRepository<Event>& repository) {
+    m_eventsPerLocation.clear();
+    m_assignmentsPerMonth.clear();
+    m_eventsPerVolunteer.clear();
+    repository.forEach([this](const Event& event) { apply(event, 1); });
+}
+
+int EventAggregates::eventsAtLocation(const QString& location) const {
+    return m_eventsPerLocation.value(location);
+}
+
+int EventAggregates::assignmentsInMonth(int year, int month) const {
+    return m_assignmentsPerMonth.value(year * 100 + month);
+}
+
+int EventAggregates::eventsForVolunteer(int volunteerId) const {
+    return m_eventsPerVolunteer.value(volunteerId);
+}
+
+QHash<QString, int> EventAggregates::eventsPerLocation() const {
+    return m_eventsPerLocation;
+}
+
+QHash<int, int> EventAggregates::assignmentsPerMonth() const {
+    return m_assignmentsPerMonth;
+}
+
+QHash<int, int> EventAggregates::eventsPerVolunteer() const {
+    return m_eventsPerVolunteer;
+}
+
+std::size_t EventAggregates::memoryBytes() const {
+    std::size_t bytes = hashHeapBytes(m_eventsPerLocation) + hashHeapBytes(m_assignmentsPerMonth)
+                        + hashHeapBytes(m_eventsPerVolunteer);
+    for (auto it = m_eventsPerLocation.cbegin(); it != m_eventsPerLocation.cend(); ++it) {
+        bytes += stringHeapBytes(it.key());
+    }
+    return bytes;
+}
+
+bool EventAggregates::operator==(const EventAggregates& other) const {
+    return m_eventsPerLocation == other.m_eventsPerLocation
+        && m_assignmentsPerMonth == other.m_assignmentsPerMonth
+        && m_eventsPerVolunteer == other.m_eventsPerVolunteer;
+}
+
+void EventAggregates::onAdded(const Event& event) {
+    apply(event, 1);
+}
+
+void EventAggregates::onRemoved(const Event& event) {
+    apply(event, -1);
+}
+
+void EventAggregates::onUpdated(const Event& oldEvent, const Event& newEvent) {
+    const QList<int> oldVolunteers = oldEvent.getVolunteerIds();
+    const QList<int> newVolunteers = newEvent.getVolunteerIds();
+
+    if (oldEvent.getLocation() != newEvent.getLocation()) {
+        adjust(m_eventsPerLocation, oldEvent.getLocation(), -1);
+        adjust(m_eventsPerLocation, newEvent.getLocation(), 1);
+    }
+
+    const int oldMonth = monthKey(oldEvent.getDate());
+    const int newMonth = monthKey(newEvent.getDate());
+    if (oldMonth != newMonth) {
+        adjust(m_assignmentsPerMonth, oldMonth, -static_cast<int>(oldVolunteers.size()));
+        adjust(m_assignmentsPerMonth, newMonth, static_cast<int>(newVolunteers.size()));
+    } else if (oldVolunteers.size() != newVolunteers.size()) {
+        adjust(m_assignmentsPerMonth, newMonth, static_cast<int>(newVolunteers.size() - oldVolunteers.size()));
+    }
+
+    // Only volunteers that joined or left the event change their counters
+    if (oldVolunteers != newVolunteers) {
+        const QSet<int> before(oldVolunteers.begin(), oldVolunteers.end());
+        const QSet<int> after(newVolunteers.begin(), newVolunteers.end());
+        for (int volunteerId : before) {
+            if (!after.contains(volunteerId)) {
+                adjust(m_eventsPerVolunteer, volunteerId, -1);
+            }
+        }
+        for (int volunteerId : after) {
+            if (!before.contains(volunteerId)) {
+                adjust(m_eventsPerVolunteer, volunteerId, 1);
+            }
+        }
+    }
+}
+
+// Titles feed no counter
+void EventAggregates::onPatched(const Event& oldEvent, const Event& newEvent, std::uint32_t changedFields) {
+    if (EventFields::fromInt(changedFields).testAnyFlags(EventField::Location | EventField::Date | EventField::Volunteers)) {
+        onUpdated(oldEvent, newEvent);
+    }
+}
+
+int EventAggregates::monthKey(const QDate& date) {
+    return date.isValid() ? date.year() * 100 + date.month() : 0;
+}
+
+void EventAggregates::apply(const Event& event, int sign) {
+    const QList<int> volunteerIds = event.getVolunteerIds();
+    adjust(m_eventsPerLocation, event.getLocation(), sign);
+    if (!volunteerIds.isEmpty()) {
+        adjust(m_assignmentsPerMonth, monthKey(event.getDate()), sign * static_cast<int>(volunteerIds.size()));
+    }
+    for (int volunteerId : volunteerIds) {
+        adjust(m_eventsPerVolunteer, volunteerId, sign);
+    }
+}
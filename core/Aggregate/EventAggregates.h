@@ -0,0 +1,58 @@
+#ifndef EVENTAGGREGATES_H
+#define EVENTAGGREGATES_H
+
+#include "../../Model/Event.h"
+#include "../../Model/EventFields.h"
+#include "../../Repository/BaseRepository.h"
+#include "../../Repository/RepositoryObserver.h"
+#include <QHash>
+#include <QString>
+
+// Dashboard counters maintained incrementally from repository notifications.
+// Each change adjusts only the counters it touches; reads are hash lookups.
+class EventAggregates : public RepositoryObserver<Event> {
+public:
+    // Recounts everything from the repository
+    void rebuild(const BaseRepository<Event>& repository);
+
+    int eventsAtLocation(const QString& location) const;
+    int assignmentsInMonth(int year, int month) const;
+    int eventsForVolunteer(int volunteerId) const;
+
+    QHash<QString, int> eventsPerLocation() const;
+    QHash<int, int> assignmentsPerMonth() const; // Keyed by year * 100 + month
+    QHash<int, int> eventsPerVolunteer() const;
+
+    // Estimated heap held by the counters, including location keys
+    std::size_t memoryBytes() const;
+
+    bool operator==(const EventAggregates& other) const;
+
+    void onAdded(const Event& event) override;
+    void onRemoved(const Event& event) override;
+    void onUpdated(const Event& oldEvent, const Event& newEvent) override;
+    void onPatched(const Event& oldEvent, const Event& newEvent, std::uint32_t changedFields) override;
+
+private:
+    static int monthKey(const QDate& date);
+    void apply(const Event& event, int sign);
+
+    template <typename Key>
+    static void adjust(QHash<Key, int>& counters, const Key& key, int delta) {
+        if (delta == 0) {
+            return;
+        }
+        auto it = counters.find(key);
+        if (it == counters.end()) {
+            counters.insert(key, delta);
+        } else if ((*it += delta) == 0) {
+            counters.erase(it); // Keep only non-zero counters so rebuilt views compare equal
+        }
+    }
+
+    QHash<QString, int> m_eventsPerLocation;
+    QHash<int, int> m_assignmentsPerMonth;
+    QHash<int, int> m_eventsPerVolunteer;
+};
+
+#endif // EVENTAGGREGATES_H
@@ -0,0 +1,188 @@
+#include "BookingIndex.h"
+#include "../Metrics/MemoryUsage.h"
+#include <QSet>
+#include <QThread>
+#include <QtConcurrent/QtConcurrent>
+#include <algorithm>
+#include <tuple>
+
+void BookingIndex::rebuild(const BaseRepository<Event>& repository) {
+    m_slots.clear();
+    m_eventsOf.clear();
+    repository.forEach([this](const Event& event) { onAdded(event); });
+}
+
+QList<int> BookingIndex::conflictsFor(int volunteerId, const QDate& date, int excludeEventId) const {
+    QList<int> conflicts;
+    if (!date.isValid()) {
+        return conflicts;
+    }
+    auto it = m_slots.constFind({volunteerId, date.toJulianDay()});
+    if (it != m_slots.constEnd()) {
+        for (int eventId : *it) {
+            if (eventId != excludeEventId) {
+                conflicts.append(eventId);
+            }
+        }
+    }
+    return conflicts;
+}
+
+QList<int> BookingIndex::eventsFor(int volunteerId) const {
+    return m_eventsOf.value(volunteerId);
+}
+
+std::size_t BookingIndex::memoryBytes() const {
+    std::size_t bytes = hashHeapBytes(m_slots) + hashHeapBytes(m_eventsOf);
+    for (const QList<int>& eventIds : m_slots) {
+        bytes += listHeapBytes(eventIds);
+    }
+    for (const QList<int>& eventIds : m_eventsOf) {
+        bytes += listHeapBytes(eventIds);
+    }
+    return bytes;
+}
+
+void BookingIndex::onAdded(const Event& event) {
+    for (int volunteerId : event.getVolunteerIds()) {
+        book(volunteerId, event.getDate(), event.getId());
+    }
+}
+
+void BookingIndex::onRemoved(const Event& event) {
+    for (int volunteerId : event.getVolunteerIds()) {
+        release(volunteerId, event.getDate(), event.getId());
+    }
+}
+
+void BookingIndex::onUpdated(const Event& oldEvent, const Event& newEvent) {
+    if (oldEvent.getDate() != newEvent.getDate()) {
+        onRemoved(oldEvent);
+        onAdded(newEvent);
+        return;
+    }
+
+    // Same day: only volunteers that joined or left change slots
+    const QList<int> oldVolunteers = oldEvent.getVolunteerIds();
+    const QList<int> newVolunteers = newEvent.getVolunteerIds();
+    if (oldVolunteers == newVolunteers) {
+        return;
+    }
+    const QSet<int> before(oldVolunteers.begin(), oldVolunteers.end());
+    const QSet<int> after(newVolunteers.begin(), newVolunteers.end());
+    for (int volunteerId : before) {
+        if (!after.contains(volunteerId)) {
+            release(volunteerId, oldEvent.getDate(), oldEvent.getId());
+        }
+    }
+    for (int volunteerId : after) {
+        if (!before.contains(volunteerId)) {
+            book(volunteerId, newEvent.getDate(), newEvent.getId());
+        }
+    }
+}
+
+// Slots depend on the date and the assigned volunteers only
+void BookingIndex::onPatched(const Event& oldEvent, const Event& newEvent, std::uint32_t changedFields) {
+    if (EventFields::fromInt(changedFields).testAnyFlags(EventField::Date | EventField::Volunteers)) {
+        onUpdated(oldEvent, newEvent);
+    }
+}
+
+void BookingIndex::book(int volunteerId, const QDate& date, int eventId) {
+    m_eventsOf[volunteerId].append(eventId);
+    if (date.isValid()) {
+        m_slots[{volunteerId, date.toJulianDay()}].append(eventId);
+    }
+}
+
+void BookingIndex::release(int volunteerId, const QDate& date, int eventId) {
+    auto events = m_eventsOf.find(volunteerId);
+    if (events != m_eventsOf.end()) {
+        events->removeOne(eventId);
+        if (events->isEmpty()) {
+            m_eventsOf.erase(events);
+        }
+    }
+    if (!date.isValid()) {
+        return;
+    }
+    auto it = m_slots.find({volunteerId, date.toJulianDay()});
+    if (it != m_slots.end()) {
+        it->removeOne(eventId);
+        if (it->isEmpty()) {
+            m_slots.erase(it);
+        }
+    }
+}
+
+std::vector<BookingConflict> BookingIndex::scanConflicts(const BaseRepository<Event>& repository) {
+    using Booking = std::tuple<int, qint64, int>; // Volunteer id, julian day, event id
+
+    std::vector<const Event*> events;
+    repository.forEach([&events](const Event& event) { events.push_back(&event); });
+
+    // Phase 1: each chunk of events spreads its bookings over shards keyed by volunteer
+    const int shardCount = std::max(1, QThread::idealThreadCount());
+    const std::size_t chunkSize = std::max<std::size_t>(1024, events.size() / shardCount + 1);
+    std::vector<std::pair<std::size_t, std::size_t>> chunks;
+    for (std::size_t begin = 0; begin < events.size(); begin += chunkSize) {
+        chunks.emplace_back(begin, std::min(begin + chunkSize, events.size()));
+    }
+    const QList<std::vector<std::vector<Booking>>> sharded = QtConcurrent::blockingMapped<QList<std::vector<std::vector<Booking>>>>(
+        chunks, [&](const std::pair<std::size_t, std::size_t>& chunk) {
+            std::vector<std::vector<Booking>> shards(shardCount);
+            for (std::size_t i = chunk.first; i < chunk.second; ++i) {
+                const Event& event = *events[i];
+                if (!event.getDate().isValid()) {
+                    continue;
+                }
+                for (int volunteerId : event.getVolunteerIds()) {
+                    const int shard = static_cast<int>(static_cast<unsigned int>(volunteerId) % shardCount);
+                    shards[shard].emplace_back(volunteerId, event.getDate().toJulianDay(), event.getId());
+                }
+            }
+            return shards;
+        });
+
+    // Phase 2: each shard sorts its bookings and reports runs sharing a (volunteer, day) slot
+    std::vector<int> shardIds(shardCount);
+    for (int shard = 0; shard < shardCount; ++shard) {
+        shardIds[shard] = shard;
+    }
+    const QList<std::vector<BookingConflict>> perShard = QtConcurrent::blockingMapped<QList<std::vector<BookingConflict>>>(
+        shardIds, [&](int shard) {
+            std::vector<Booking> bookings;
+            for (const auto& chunkShards : sharded) {
+                bookings.insert(bookings.end(), chunkShards[shard].begin(), chunkShards[shard].end());
+            }
+            std::sort(bookings.begin(), bookings.end());
+
+            std::vector<BookingConflict> conflicts;
+            for (std::size_t i = 0; i < bookings.size();) {
+                std::size_t j = i + 1;
+                while (j < bookings.size() && std::get<0>(bookings[j]) == std::get<0>(bookings[i])
+                       && std::get<1>(bookings[j]) == std::get<1>(bookings[i])) {
+                    ++j;
+                }
+                if (j - i > 1) {
+                    BookingConflict conflict{std::get<0>(bookings[i]), QDate::fromJulianDay(std::get<1>(bookings[i])), {}};
+                    for (std::size_t k = i; k < j; ++k) {
+                        conflict.eventIds.append(std::get<2>(bookings[k]));
+                    }
+                    conflicts.push_back(conflict);
+                }
+                i = j;
+            }
+            return conflicts;
+        });
+
+    std::vector<BookingConflict> report;
+    for (const auto& conflicts : perShard) {
+        report.insert(report.end(), conflicts.begin(), conflicts.end());
+    }
+    std::sort(report.begin(), report.end(), [](const BookingConflict& a, const BookingConflict& b) {
+        return a.volunteerId != b.volunteerId ? a.volunteerId < b.volunteerId : a.date < b.date;
+    });
+    return report;
+}
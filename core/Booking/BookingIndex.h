@@ -0,0 +1,55 @@
+#ifndef BOOKINGINDEX_H
+#define BOOKINGINDEX_H
+
+#include "../../Model/Event.h"
+#include "../../Model/EventFields.h"
+#include "../../Repository/BaseRepository.h"
+#include "../../Repository/RepositoryObserver.h"
+#include <QDate>
+#include <QHash>
+#include <QList>
+#include <utility>
+#include <vector>
+
+enum class DoubleBookingPolicy {
+    Reject, // Refuse an assignment that overlaps another event on the same day
+    Warn    // Allow it, but log the conflict
+};
+
+struct BookingConflict {
+    int volunteerId;
+    QDate date;
+    QList<int> eventIds; // Every event booking the volunteer that day, ascending
+};
+
+// (volunteer, day) -> events occupying that slot, kept current through repository notifications
+class BookingIndex : public RepositoryObserver<Event> {
+public:
+    void rebuild(const BaseRepository<Event>& repository);
+
+    // Events other than excludeEventId that already book the volunteer on date: O(1)
+    QList<int> conflictsFor(int volunteerId, const QDate& date, int excludeEventId) const;
+    // Every event the volunteer is assigned to, dated or not: O(1)
+    QList<int> eventsFor(int volunteerId) const;
+    // Estimated heap held by both hashes and their event lists
+    std::size_t memoryBytes() const;
+
+    void onAdded(const Event& event) override;
+    void onRemoved(const Event& event) override;
+    void onUpdated(const Event& oldEvent, const Event& newEvent) override;
+    void onPatched(const Event& oldEvent, const Event& newEvent, std::uint32_t changedFields) override;
+
+    // Scans every event for double bookings, sharded by volunteer across the thread pool
+    static std::vector<BookingConflict> scanConflicts(const BaseRepository<Event>& repository);
+
+private:
+    using Slot = std::pair<int, qint64>; // Volunteer id, julian day
+
+    void book(int volunteerId, const QDate& date, int eventId);
+    void release(int volunteerId, const QDate& date, int eventId);
+
+    QHash<Slot, QList<int>> m_slots;
+    QHash<int, QList<int>> m_eventsOf; // Volunteer id -> assigned events, including undated ones
+};
+
+#endif // BOOKINGINDEX_H
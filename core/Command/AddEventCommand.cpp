@@ -1,12 +1,28 @@
 #include "AddEventCommand.h"
+#include "../Trace/Trace.h"
 
-AddEventCommand::AddEventCommand(BaseRepository<Event>* eventRepo, const Event& event)
-    : m_eventRepo(eventRepo), m_event(event) {}
+AddEventCommand::AddEventCommand(BaseRepository<Event>* eventRepo, Event event)
+    : m_eventRepo(eventRepo), m_eventId(event.getId()), m_event(std::move(event)) {}
 
 void AddEventCommand::execute() {
-    m_eventRepo->add(m_event);
+    TRACE_SCOPE("command", "AddEventCommand::execute");
+    if (m_event) {
+        m_eventRepo->add(std::move(*m_event));
+        m_event.reset();
+    }
 }
 
 void AddEventCommand::undo() {
-    m_eventRepo->remove(m_event.getId());
+    TRACE_SCOPE("command", "AddEventCommand::undo");
+    m_event = m_eventRepo->take(m_eventId);
+}
+
+MemoryUsage AddEventCommand::memoryUsage() const {
+    MemoryUsage usage;
+    usage.items = 1;
+    usage.objectBytes = sizeof(*this);
+    if (m_event) {
+        addHeapUsage(usage, *m_event);
+    }
+    return usage;
 }
\ No newline at end of file
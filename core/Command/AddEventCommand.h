@@ -4,16 +4,20 @@
 #include "Command.h"
 #include "../../Model/Event.h"
 #include "../../Repository/BaseRepository.h"
+#include <optional>
 
+// Holds the event only while it is not in storage: execute moves it in, undo takes it back out
 class AddEventCommand : public Command {
 public:
-    AddEventCommand(BaseRepository<Event>* eventRepo, const Event& event);
+    AddEventCommand(BaseRepository<Event>* eventRepo, Event event);
     void execute() override;
     void undo() override;
+    MemoryUsage memoryUsage() const override;
 
 private:
     BaseRepository<Event>* m_eventRepo;
-    Event m_event;
+    int m_eventId;
+    std::optional<Event> m_event;
 };
 
 #endif // ADDEVENTCOMMAND_H
\ No newline at end of file
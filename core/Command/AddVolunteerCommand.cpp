@@ -1,12 +1,34 @@
 #include "AddVolunteerCommand.h"
+#include "../Trace/Trace.h"
 
-AddVolunteerCommand::AddVolunteerCommand(BaseRepository<Volunteer>* volunteerRepo, const Volunteer& volunteer)
-    : m_volunteerRepo(volunteerRepo), m_volunteer(volunteer) {}
+AddVolunteerCommand::AddVolunteerCommand(BaseRepository<Volunteer>* volunteerRepo, BaseRepository<Event>* eventRepo,
+                                         const BookingIndex* bookings, Volunteer volunteer)
+    : m_volunteerRepo(volunteerRepo), m_eventRepo(eventRepo), m_bookings(bookings),
+      m_volunteerId(volunteer.getId()), m_volunteer(std::move(volunteer)) {}
 
 void AddVolunteerCommand::execute() {
-    m_volunteerRepo->add(m_volunteer);
+    TRACE_SCOPE("command", "AddVolunteerCommand::execute");
+    if (m_volunteer) {
+        m_volunteerRepo->add(std::move(*m_volunteer));
+        m_volunteer.reset();
+        restoreMemberships(m_eventRepo, m_memberships);
+    }
 }
 
 void AddVolunteerCommand::undo() {
-    m_volunteerRepo->remove(m_volunteer.getId());
+    TRACE_SCOPE("command", "AddVolunteerCommand::undo");
+    m_volunteer = m_volunteerRepo->take(m_volunteerId);
+    if (m_volunteer) {
+        m_memberships = unassignVolunteer(m_eventRepo, m_bookings, m_volunteerId);
+    }
+}
+
+MemoryUsage AddVolunteerCommand::memoryUsage() const {
+    MemoryUsage usage;
+    usage.items = 1;
+    usage.objectBytes = sizeof(*this) + m_memberships.capacity() * sizeof(VolunteerMembership);
+    if (m_volunteer) {
+        addHeapUsage(usage, *m_volunteer);
+    }
+    return usage;
 }
\ No newline at end of file
@@ -4,16 +4,27 @@
 #include "Command.h"
 #include "../../Model/Volunteer.h"
 #include "../../Repository/BaseRepository.h" // Assuming your Controller uses this
+#include "VolunteerMemberships.h"
+#include <optional>
+#include <vector>
 
+// Holds the volunteer only while it is not in storage: execute moves it in, undo takes it back out.
+// Undo also takes the volunteer off any events it was assigned to since; redo restores them.
 class AddVolunteerCommand : public Command {
 public:
-    AddVolunteerCommand(BaseRepository<Volunteer>* volunteerRepo, const Volunteer& volunteer);
+    AddVolunteerCommand(BaseRepository<Volunteer>* volunteerRepo, BaseRepository<Event>* eventRepo,
+                        const BookingIndex* bookings, Volunteer volunteer);
     void execute() override;
     void undo() override;
+    MemoryUsage memoryUsage() const override;
 
 private:
     BaseRepository<Volunteer>* m_volunteerRepo;
-    Volunteer m_volunteer;
+    BaseRepository<Event>* m_eventRepo;
+    const BookingIndex* m_bookings;
+    int m_volunteerId;
+    std::optional<Volunteer> m_volunteer;
+    std::vector<VolunteerMembership> m_memberships;
 };
 
 #endif // ADDVOLUNTEERCOMMAND_H
\ No newline at end of file
@@ -1,11 +1,15 @@
 #ifndef COMMAND_H
 #define COMMAND_H
 
+#include "../Metrics/MemoryUsage.h"
+
 class Command {
 public:
     virtual ~Command() = default;
     virtual void execute() = 0;
     virtual void undo() = 0;
+    // Estimated bytes this command keeps alive on the undo or redo stack
+    virtual MemoryUsage memoryUsage() const = 0;
 };
 
 #endif // COMMAND_H
\ No newline at end of file
@@ -0,0 +1,27 @@
+#include "ImportEventsCommand.h"
+#include "../Trace/Trace.h"
+
+ImportEventsCommand::ImportEventsCommand(BaseRepository<Event>* eventRepo, const std::vector<Event>& events)
+    : m_eventRepo(eventRepo), m_events(events) {}
+
+void ImportEventsCommand::execute() {
+    TRACE_SCOPE("command", "ImportEventsCommand::execute");
+    m_eventRepo->addBatch(m_events);
+}
+
+void ImportEventsCommand::undo() {
+    TRACE_SCOPE("command", "ImportEventsCommand::undo");
+    std::vector<int> ids;
+    ids.reserve(m_events.size());
+    for (const auto& event : m_events) {
+        ids.push_back(event.getId());
+    }
+    m_eventRepo->removeBatch(ids);
+}
+
+MemoryUsage ImportEventsCommand::memoryUsage() const {
+    MemoryUsage usage;
+    addVectorUsage(usage, m_events);
+    usage.objectBytes += sizeof(*this);
+    return usage;
+}
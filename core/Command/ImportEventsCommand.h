@@ -0,0 +1,21 @@
+#ifndef IMPORTEVENTSCOMMAND_H
+#define IMPORTEVENTSCOMMAND_H
+
+#include "Command.h"
+#include "../../Model/Event.h"
+#include "../../Repository/BaseRepository.h"
+#include <vector>
+
+class ImportEventsCommand : public Command {
+public:
+    ImportEventsCommand(BaseRepository<Event>* eventRepo, const std::vector<Event>& events);
+    void execute() override;
+    void undo() override;
+    MemoryUsage memoryUsage() const override;
+
+private:
+    BaseRepository<Event>* m_eventRepo;
+    std::vector<Event> m_events;
+};
+
+#endif // IMPORTEVENTSCOMMAND_H
@@ -0,0 +1,31 @@
+#include "ImportVolunteersCommand.h"
+#include "../Trace/Trace.h"
+
+ImportVolunteersCommand::ImportVolunteersCommand(BaseRepository<Volunteer>* volunteerRepo, BaseRepository<Event>* eventRepo,
+                                                 const BookingIndex* bookings, const std::vector<Volunteer>& volunteers)
+    : m_volunteerRepo(volunteerRepo), m_eventRepo(eventRepo), m_bookings(bookings), m_volunteers(volunteers) {}
+
+void ImportVolunteersCommand::execute() {
+    TRACE_SCOPE("command", "ImportVolunteersCommand::execute");
+    m_volunteerRepo->addBatch(m_volunteers);
+    restoreMemberships(m_eventRepo, m_memberships);
+}
+
+void ImportVolunteersCommand::undo() {
+    TRACE_SCOPE("command", "ImportVolunteersCommand::undo");
+    std::vector<int> ids;
+    ids.reserve(m_volunteers.size());
+    for (const auto& volunteer : m_volunteers) {
+        ids.push_back(volunteer.getId());
+        std::vector<VolunteerMembership> memberships = unassignVolunteer(m_eventRepo, m_bookings, volunteer.getId());
+        m_memberships.insert(m_memberships.end(), memberships.begin(), memberships.end());
+    }
+    m_volunteerRepo->removeBatch(ids);
+}
+
+MemoryUsage ImportVolunteersCommand::memoryUsage() const {
+    MemoryUsage usage;
+    addVectorUsage(usage, m_volunteers);
+    usage.objectBytes += sizeof(*this) + m_memberships.capacity() * sizeof(VolunteerMembership);
+    return usage;
+}
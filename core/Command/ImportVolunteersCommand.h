@@ -0,0 +1,27 @@
+#ifndef IMPORTVOLUNTEERSCOMMAND_H
+#define IMPORTVOLUNTEERSCOMMAND_H
+
+#include "Command.h"
+#include "../../Model/Volunteer.h"
+#include "../../Repository/BaseRepository.h"
+#include "VolunteerMemberships.h"
+#include <vector>
+
+// Undo also takes the imported volunteers off any events they were assigned to since; redo restores them
+class ImportVolunteersCommand : public Command {
+public:
+    ImportVolunteersCommand(BaseRepository<Volunteer>* volunteerRepo, BaseRepository<Event>* eventRepo,
+                            const BookingIndex* bookings, const std::vector<Volunteer>& volunteers);
+    void execute() override;
+    void undo() override;
+    MemoryUsage memoryUsage() const override;
+
+private:
+    BaseRepository<Volunteer>* m_volunteerRepo;
+    BaseRepository<Event>* m_eventRepo;
+    const BookingIndex* m_bookings;
+    std::vector<Volunteer> m_volunteers;
+    std::vector<VolunteerMembership> m_memberships;
+};
+
+#endif // IMPORTVOLUNTEERSCOMMAND_H
@@ -0,0 +1,29 @@
+#include "PatchEventCommand.h"
+#include "../Trace/Trace.h"
+
+PatchEventCommand::PatchEventCommand(BaseRepository<Event>* eventRepo, int eventId, EventFields fields, EventFieldValues values)
+    : m_eventRepo(eventRepo), m_eventId(eventId), m_fields(fields), m_values(std::move(values)) {}
+
+void PatchEventCommand::execute() {
+    TRACE_SCOPE("command", "PatchEventCommand::execute");
+    swapWithStored();
+}
+
+void PatchEventCommand::undo() {
+    TRACE_SCOPE("command", "PatchEventCommand::undo");
+    swapWithStored();
+}
+
+void PatchEventCommand::swapWithStored() {
+    m_eventRepo->patch(m_eventId, m_fields.toInt(),
+                       [this](Event& event) { swapEventFields(event, m_fields, m_values); });
+}
+
+MemoryUsage PatchEventCommand::memoryUsage() const {
+    MemoryUsage usage;
+    usage.items = 1;
+    usage.objectBytes = sizeof(*this);
+    usage.stringBytes += stringHeapBytes(m_values.title) + stringHeapBytes(m_values.location);
+    usage.listBytes += listHeapBytes(m_values.volunteerIds);
+    return usage;
+}
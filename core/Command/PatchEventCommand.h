@@ -0,0 +1,26 @@
+#ifndef PATCHEVENTCOMMAND_H
+#define PATCHEVENTCOMMAND_H
+
+#include "Command.h"
+#include "../../Model/EventFields.h"
+#include "../../Repository/BaseRepository.h"
+
+// Partial event update. Holds only the patched fields: the new values until executed, then the
+// values they replaced, so execute and undo are the same in-place swap.
+class PatchEventCommand : public Command {
+public:
+    PatchEventCommand(BaseRepository<Event>* eventRepo, int eventId, EventFields fields, EventFieldValues values);
+    void execute() override;
+    void undo() override;
+    MemoryUsage memoryUsage() const override;
+
+private:
+    BaseRepository<Event>* m_eventRepo;
+    int m_eventId;
+    EventFields m_fields;
+    EventFieldValues m_values;
+
+    void swapWithStored();
+};
+
+#endif // PATCHEVENTCOMMAND_H
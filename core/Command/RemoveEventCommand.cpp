@@ -1,12 +1,28 @@
 #include "RemoveEventCommand.h"
+#include "../Trace/Trace.h"
 
-RemoveEventCommand::RemoveEventCommand(BaseRepository<Event>* eventRepo, const Event& event)
-    : m_eventRepo(eventRepo), m_event(event) {}
+RemoveEventCommand::RemoveEventCommand(BaseRepository<Event>* eventRepo, int eventId)
+    : m_eventRepo(eventRepo), m_eventId(eventId) {}
 
 void RemoveEventCommand::execute() {
-    m_eventRepo->remove(m_event.getId());
+    TRACE_SCOPE("command", "RemoveEventCommand::execute");
+    m_event = m_eventRepo->take(m_eventId);
 }
 
 void RemoveEventCommand::undo() {
-    m_eventRepo->add(m_event);
+    TRACE_SCOPE("command", "RemoveEventCommand::undo");
+    if (m_event) {
+        m_eventRepo->add(std::move(*m_event));
+        m_event.reset();
+    }
+}
+
+MemoryUsage RemoveEventCommand::memoryUsage() const {
+    MemoryUsage usage;
+    usage.items = 1;
+    usage.objectBytes = sizeof(*this);
+    if (m_event) {
+        addHeapUsage(usage, *m_event);
+    }
+    return usage;
 }
\ No newline at end of file
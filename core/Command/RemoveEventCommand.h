@@ -4,16 +4,20 @@
 #include "Command.h"
 #include "../../Model/Event.h"
 #include "../../Repository/BaseRepository.h"
+#include <optional>
 
+// Holds the event only while it is out of storage: execute takes it out, undo moves it back in
 class RemoveEventCommand : public Command {
 public:
-    RemoveEventCommand(BaseRepository<Event>* eventRepo, const Event& event);
+    RemoveEventCommand(BaseRepository<Event>* eventRepo, int eventId);
     void execute() override;
     void undo() override;
+    MemoryUsage memoryUsage() const override;
 
 private:
     BaseRepository<Event>* m_eventRepo;
-    Event m_event;
+    int m_eventId;
+    std::optional<Event> m_event;
 };
 
 #endif // REMOVEEVENTCOMMAND_H
\ No newline at end of file
@@ -1,12 +1,33 @@
 #include "RemoveVolunteerCommand.h"
+#include "../Trace/Trace.h"
 
-RemoveVolunteerCommand::RemoveVolunteerCommand(BaseRepository<Volunteer>* volunteerRepo, const Volunteer& volunteer)
-    : m_volunteerRepo(volunteerRepo), m_volunteer(volunteer) {}
+RemoveVolunteerCommand::RemoveVolunteerCommand(BaseRepository<Volunteer>* volunteerRepo, BaseRepository<Event>* eventRepo,
+                                               const BookingIndex* bookings, int volunteerId)
+    : m_volunteerRepo(volunteerRepo), m_eventRepo(eventRepo), m_bookings(bookings), m_volunteerId(volunteerId) {}
 
 void RemoveVolunteerCommand::execute() {
-    m_volunteerRepo->remove(m_volunteer.getId());
+    TRACE_SCOPE("command", "RemoveVolunteerCommand::execute");
+    m_volunteer = m_volunteerRepo->take(m_volunteerId);
+    if (m_volunteer) {
+        m_memberships = unassignVolunteer(m_eventRepo, m_bookings, m_volunteerId);
+    }
 }
 
 void RemoveVolunteerCommand::undo() {
-    m_volunteerRepo->add(m_volunteer);
+    TRACE_SCOPE("command", "RemoveVolunteerCommand::undo");
+    if (m_volunteer) {
+        m_volunteerRepo->add(std::move(*m_volunteer));
+        m_volunteer.reset();
+        restoreMemberships(m_eventRepo, m_memberships);
+    }
+}
+
+MemoryUsage RemoveVolunteerCommand::memoryUsage() const {
+    MemoryUsage usage;
+    usage.items = 1;
+    usage.objectBytes = sizeof(*this) + m_memberships.capacity() * sizeof(VolunteerMembership);
+    if (m_volunteer) {
+        addHeapUsage(usage, *m_volunteer);
+    }
+    return usage;
 }
\ No newline at end of file
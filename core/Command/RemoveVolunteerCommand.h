@@ -4,16 +4,27 @@
 #include "Command.h"
 #include "../../Model/Volunteer.h"
 #include "../../Repository/BaseRepository.h"
+#include "VolunteerMemberships.h"
+#include <optional>
+#include <vector>
 
+// Holds the volunteer only while it is out of storage: execute takes it out, undo moves it back in.
+// The volunteer is also taken off every event it was assigned to, and undo puts it back in place.
 class RemoveVolunteerCommand : public Command {
 public:
-    RemoveVolunteerCommand(BaseRepository<Volunteer>* volunteerRepo, const Volunteer& volunteer);
+    RemoveVolunteerCommand(BaseRepository<Volunteer>* volunteerRepo, BaseRepository<Event>* eventRepo,
+                           const BookingIndex* bookings, int volunteerId);
     void execute() override;
     void undo() override;
+    MemoryUsage memoryUsage() const override;
 
 private:
     BaseRepository<Volunteer>* m_volunteerRepo;
-    Volunteer m_volunteer;
+    BaseRepository<Event>* m_eventRepo;
+    const BookingIndex* m_bookings;
+    int m_volunteerId;
+    std::optional<Volunteer> m_volunteer;
+    std::vector<VolunteerMembership> m_memberships;
 };
 
 #endif // REMOVEVOLUNTEERCOMMAND_H
\ No newline at end of file
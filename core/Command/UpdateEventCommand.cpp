@@ -1,12 +1,38 @@
 #include "UpdateEventCommand.h"
+#include "../Trace/Trace.h"
 
-UpdateEventCommand::UpdateEventCommand(BaseRepository<Event>* eventRepo, const Event& oldEvent, const Event& newEvent)
-    : m_eventRepo(eventRepo), m_oldEvent(oldEvent), m_newEvent(newEvent) {}
+UpdateEventCommand::UpdateEventCommand(BaseRepository<Event>* eventRepo, Event newEvent)
+    : m_eventRepo(eventRepo), m_newEvent(std::move(newEvent)) {}
+
+// Moves incoming into storage and keeps the version it replaced; nothing changes if the ID is gone
+void UpdateEventCommand::swapIn(BaseRepository<Event>* repo, std::optional<Event>& incoming, std::optional<Event>& outgoing) {
+    if (!incoming) {
+        return;
+    }
+    if (std::optional<Event> previous = repo->replace(std::move(*incoming))) {
+        outgoing = std::move(previous);
+        incoming.reset();
+    }
+}
 
 void UpdateEventCommand::execute() {
-    m_eventRepo->update(m_newEvent);
+    TRACE_SCOPE("command", "UpdateEventCommand::execute");
+    swapIn(m_eventRepo, m_newEvent, m_oldEvent);
 }
 
 void UpdateEventCommand::undo() {
-    m_eventRepo->update(m_oldEvent);
+    TRACE_SCOPE("command", "UpdateEventCommand::undo");
+    swapIn(m_eventRepo, m_oldEvent, m_newEvent);
+}
+
+MemoryUsage UpdateEventCommand::memoryUsage() const {
+    MemoryUsage usage;
+    usage.objectBytes = sizeof(*this);
+    for (const auto* held : {&m_oldEvent, &m_newEvent}) {
+        if (*held) {
+            ++usage.items;
+            addHeapUsage(usage, **held);
+        }
+    }
+    return usage;
 }
\ No newline at end of file
@@ -4,17 +4,22 @@
 #include "Command.h"
 #include "../../Model/Event.h"
 #include "../../Repository/BaseRepository.h"
+#include <optional>
 
+// Holds whichever version is not in storage; execute and undo swap it with the stored one
 class UpdateEventCommand : public Command {
 public:
-    UpdateEventCommand(BaseRepository<Event>* eventRepo, const Event& oldEvent, const Event& newEvent);
+    UpdateEventCommand(BaseRepository<Event>* eventRepo, Event newEvent);
     void execute() override;
     void undo() override;
+    MemoryUsage memoryUsage() const override;
 
 private:
     BaseRepository<Event>* m_eventRepo;
-    Event m_oldEvent;
-    Event m_newEvent;
+    std::optional<Event> m_oldEvent;
+    std::optional<Event> m_newEvent;
+
+    static void swapIn(BaseRepository<Event>* repo, std::optional<Event>& incoming, std::optional<Event>& outgoing);
 };
 
 #endif // UPDATEEVENTCOMMAND_H
\ No newline at end of file
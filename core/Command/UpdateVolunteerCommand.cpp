@@ -1,12 +1,38 @@
 #include "UpdateVolunteerCommand.h"
+#include "../Trace/Trace.h"
 
-UpdateVolunteerCommand::UpdateVolunteerCommand(BaseRepository<Volunteer>* volunteerRepo, const Volunteer& oldVolunteer, const Volunteer& newVolunteer)
-    : m_volunteerRepo(volunteerRepo), m_oldVolunteer(oldVolunteer), m_newVolunteer(newVolunteer) {}
+UpdateVolunteerCommand::UpdateVolunteerCommand(BaseRepository<Volunteer>* volunteerRepo, Volunteer newVolunteer)
+    : m_volunteerRepo(volunteerRepo), m_newVolunteer(std::move(newVolunteer)) {}
+
+// Moves incoming into storage and keeps the version it replaced; nothing changes if the ID is gone
+void UpdateVolunteerCommand::swapIn(BaseRepository<Volunteer>* repo, std::optional<Volunteer>& incoming, std::optional<Volunteer>& outgoing) {
+    if (!incoming) {
+        return;
+    }
+    if (std::optional<Volunteer> previous = repo->replace(std::move(*incoming))) {
+        outgoing = std::move(previous);
+        incoming.reset();
+    }
+}
 
 void UpdateVolunteerCommand::execute() {
-    m_volunteerRepo->update(m_newVolunteer);
+    TRACE_SCOPE("command", "UpdateVolunteerCommand::execute");
+    swapIn(m_volunteerRepo, m_newVolunteer, m_oldVolunteer);
 }
 
 void UpdateVolunteerCommand::undo() {
-    m_volunteerRepo->update(m_oldVolunteer);
+    TRACE_SCOPE("command", "UpdateVolunteerCommand::undo");
+    swapIn(m_volunteerRepo, m_oldVolunteer, m_newVolunteer);
+}
+
+MemoryUsage UpdateVolunteerCommand::memoryUsage() const {
+    MemoryUsage usage;
+    usage.objectBytes = sizeof(*this);
+    for (const auto* held : {&m_oldVolunteer, &m_newVolunteer}) {
+        if (*held) {
+            ++usage.items;
+            addHeapUsage(usage, **held);
+        }
+    }
+    return usage;
 }
\ No newline at end of file
@@ -4,17 +4,22 @@
 #include "Command.h"
 #include "../../Model/Volunteer.h"
 #include "../../Repository/BaseRepository.h"
+#include <optional>
 
+// Holds whichever version is not in storage; execute and undo swap it with the stored one
 class UpdateVolunteerCommand : public Command {
 public:
-    UpdateVolunteerCommand(BaseRepository<Volunteer>* volunteerRepo, const Volunteer& oldVolunteer, const Volunteer& newVolunteer);
+    UpdateVolunteerCommand(BaseRepository<Volunteer>* volunteerRepo, Volunteer newVolunteer);
     void execute() override;
     void undo() override;
+    MemoryUsage memoryUsage() const override;
 
 private:
     BaseRepository<Volunteer>* m_volunteerRepo;
-    Volunteer m_oldVolunteer;
-    Volunteer m_newVolunteer;
+    std::optional<Volunteer> m_oldVolunteer;
+    std::optional<Volunteer> m_newVolunteer;
+
+    static void swapIn(BaseRepository<Volunteer>* repo, std::optional<Volunteer>& incoming, std::optional<Volunteer>& outgoing);
 };
 
 #endif // UPDATEVOLUNTEERCOMMAND_H
\ No newline at end of file
@@ -0,0 +1,39 @@
+#include "VolunteerMemberships.h"
+#include "../../Model/EventFields.h"
+#include <algorithm>
+
+std::vector<VolunteerMembership> unassignVolunteer(BaseRepository<Event>* eventRepo, const BookingIndex* bookings,
+                                                   int volunteerId) {
+    std::vector<VolunteerMembership> memberships;
+    if (!eventRepo || !bookings) {
+        return memberships;
+    }
+    const QList<int> eventIds = bookings->eventsFor(volunteerId); // A copy: each patch updates the index
+    for (int eventId : eventIds) {
+        eventRepo->patch(eventId, static_cast<std::uint32_t>(EventField::Volunteers), [&](Event& event) {
+            QList<int> volunteerIds = event.getVolunteerIds();
+            const qsizetype position = volunteerIds.indexOf(volunteerId);
+            if (position >= 0) {
+                volunteerIds.removeAt(position);
+                event.setVolunteerIds(std::move(volunteerIds));
+                memberships.push_back({eventId, volunteerId, position});
+            }
+        });
+    }
+    return memberships;
+}
+
+void restoreMemberships(BaseRepository<Event>* eventRepo, std::vector<VolunteerMembership>& memberships) {
+    if (!eventRepo) {
+        return;
+    }
+    for (auto it = memberships.rbegin(); it != memberships.rend(); ++it) {
+        const VolunteerMembership& membership = *it;
+        eventRepo->patch(membership.eventId, static_cast<std::uint32_t>(EventField::Volunteers), [&](Event& event) {
+            QList<int> volunteerIds = event.getVolunteerIds();
+            volunteerIds.insert(std::min(membership.position, volunteerIds.size()), membership.volunteerId);
+            event.setVolunteerIds(std::move(volunteerIds));
+        });
+    }
+    memberships.clear();
+}
@@ -0,0 +1,25 @@
+#ifndef VOLUNTEERMEMBERSHIPS_H
+#define VOLUNTEERMEMBERSHIPS_H
+
+#include "../../Model/Event.h"
+#include "../../Repository/BaseRepository.h"
+#include "../Booking/BookingIndex.h"
+#include <QtGlobal>
+#include <vector>
+
+// An event a removed volunteer was assigned to, and their place in its volunteer list
+struct VolunteerMembership {
+    int eventId;
+    int volunteerId;
+    qsizetype position;
+};
+
+// Takes volunteerId off every event the booking index lists for it, so a freed ID never carries
+// assignments over to the next volunteer that reuses it. Returns the removed memberships in order.
+std::vector<VolunteerMembership> unassignVolunteer(BaseRepository<Event>* eventRepo, const BookingIndex* bookings,
+                                                   int volunteerId);
+
+// Puts the memberships back at their original positions, newest first, and clears the list
+void restoreMemberships(BaseRepository<Event>* eventRepo, std::vector<VolunteerMembership>& memberships);
+
+#endif // VOLUNTEERMEMBERSHIPS_H
@@ -0,0 +1,214 @@
+#include "ReportExporter.h"
+#include <QFile>
+#include <QHash>
+#include <QThreadPool>
+#include <QDebug>
+#include <QtConcurrent/QtConcurrent>
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+using NameMap = QHash<int, QString>;
+
+QByteArray csvField(const QString& value) {
+    QByteArray bytes = value.toUtf8();
+    if (bytes.contains(',') || bytes.contains('"') || bytes.contains('\n') || bytes.contains(';')) {
+        bytes.replace("\"", "\"\"");
+        return QByteArray("\"") + bytes + QByteArray("\"");
+    }
+    return bytes;
+}
+
+void appendJsonString(QByteArray& out, const QString& value) {
+    out += '"';
+    for (char c : value.toUtf8()) {
+        switch (c) {
+        case '"': out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\n': out += "\\n"; break;
+        case '\r': out += "\\r"; break;
+        case '\t': out += "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                out += "\\u00" + QByteArray::number(static_cast<int>(c), 16).rightJustified(2, '0');
+            } else {
+                out += c;
+            }
+        }
+    }
+    out += '"';
+}
+
+void appendCsvRow(QByteArray& out, const Event& event, const NameMap& names) {
+    const QList<int> volunteerIds = event.getVolunteerIds();
+    out += QByteArray::number(event.getId());
+    out += ',';
+    out += csvField(event.getTitle());
+    out += ',';
+    out += event.getDate().toString(Qt::ISODate).toUtf8();
+    out += ',';
+    out += csvField(event.getLocation());
+    out += ',';
+    out += QByteArray::number(volunteerIds.size());
+    out += ',';
+
+    QStringList volunteerNames;
+    volunteerNames.reserve(volunteerIds.size());
+    for (int volunteerId : volunteerIds) {
+        volunteerNames.append(names.value(volunteerId));
+    }
+    out += csvField(volunteerNames.join(';'));
+    out += '\n';
+}
+
+void appendJsonRow(QByteArray& out, const Event& event, const NameMap& names) {
+    out += "{\"id\":";
+    out += QByteArray::number(event.getId());
+    out += ",\"title\":";
+    appendJsonString(out, event.getTitle());
+    out += ",\"date\":";
+    appendJsonString(out, event.getDate().toString(Qt::ISODate));
+    out += ",\"location\":";
+    appendJsonString(out, event.getLocation());
+    out += ",\"volunteers\":[";
+    bool first = true;
+    for (int volunteerId : event.getVolunteerIds()) {
+        if (!first) {
+            out += ',';
+        }
+        first = false;
+        out += "{\"id\":";
+        out += QByteArray::number(volunteerId);
+        out += ",\"name\":";
+        appendJsonString(out, names.value(volunteerId));
+        out += '}';
+    }
+    out += "]}\n";
+}
+
+QByteArray formatRows(const std::vector<const Event*>& events, std::size_t begin, std::size_t end,
+                      const NameMap& names, ExportFormat format) {
+    QByteArray out;
+    out.reserve(static_cast<qsizetype>((end - begin) * 96));
+    for (std::size_t i = begin; i < end; ++i) {
+        if (format == ExportFormat::Csv) {
+            appendCsvRow(out, *events[i], names);
+        } else {
+            appendJsonRow(out, *events[i], names);
+        }
+    }
+    return out;
+}
+
+} // namespace
+
+ReportExporter::ReportExporter(const BaseRepository<Volunteer>* volunteerRepo, const BaseRepository<Event>* eventRepo) {
+    if (volunteerRepo) {
+        m_volunteers = [volunteerRepo](const std::function<void(const Volunteer&)>& visitor) { volunteerRepo->forEach(visitor); };
+    }
+    if (eventRepo) {
+        m_events = [eventRepo](const std::function<void(const Event&)>& visitor) { eventRepo->forEach(visitor); };
+    }
+}
+
+ReportExporter::ReportExporter(std::shared_ptr<const RepositorySnapshot<Volunteer>> volunteers,
+                               std::shared_ptr<const RepositorySnapshot<Event>> events) {
+    // The sources own their snapshot, so event pointers held in a block stay valid for the whole export
+    if (volunteers) {
+        m_volunteers = [volunteers](const std::function<void(const Volunteer&)>& visitor) { volunteers->forEach(visitor); };
+    }
+    if (events) {
+        m_events = [events](const std::function<void(const Event&)>& visitor) { events->forEach(visitor); };
+    }
+}
+
+qint64 ReportExporter::exportEvents(QIODevice& out, const ExportOptions& options) const {
+    if (!m_events || !m_volunteers) {
+        qWarning() << "Repository not available. Cannot export events.";
+        return -1;
+    }
+
+    // The only structure proportional to the data set: volunteer names, shared with the repository
+    NameMap names;
+    m_volunteers([&names](const Volunteer& volunteer) {
+        names.insert(volunteer.getId(), volunteer.getName());
+    });
+
+    const std::size_t blockSize = static_cast<std::size_t>(std::max(1, options.blockSize));
+    const int threads = std::max(1, options.threads);
+    QThreadPool pool;
+    pool.setMaxThreadCount(threads);
+
+    QByteArray buffer;
+    buffer.reserve(options.bufferBytes);
+    qint64 rows = 0;
+    bool failed = false;
+
+    auto flushBuffer = [&]() {
+        if (!failed && !buffer.isEmpty() && out.write(buffer) != buffer.size()) {
+            qWarning() << "Could not write export output:" << out.errorString();
+            failed = true;
+        }
+        buffer.clear();
+    };
+
+    std::vector<const Event*> block;
+    block.reserve(blockSize);
+    auto flushBlock = [&]() {
+        if (block.empty()) {
+            return;
+        }
+        if (threads == 1) {
+            buffer += formatRows(block, 0, block.size(), names, options.format);
+        } else {
+            // Each slice is formatted independently, then appended in order
+            std::vector<std::pair<std::size_t, std::size_t>> slices;
+            const std::size_t sliceSize = (block.size() + threads - 1) / threads;
+            for (std::size_t begin = 0; begin < block.size(); begin += sliceSize) {
+                slices.emplace_back(begin, std::min(begin + sliceSize, block.size()));
+            }
+            const QList<QByteArray> formatted = QtConcurrent::blockingMapped<QList<QByteArray>>(
+                &pool, slices, [&](const std::pair<std::size_t, std::size_t>& slice) {
+                    return formatRows(block, slice.first, slice.second, names, options.format);
+                });
+            for (const QByteArray& part : formatted) {
+                buffer += part;
+            }
+        }
+        rows += static_cast<qint64>(block.size());
+        block.clear();
+        if (buffer.size() >= options.bufferBytes) {
+            flushBuffer();
+        }
+    };
+
+    if (options.format == ExportFormat::Csv) {
+        buffer += "event_id,title,date,location,volunteer_count,volunteers\n";
+    }
+    m_events([&](const Event& event) {
+        block.push_back(&event);
+        if (block.size() == blockSize) {
+            flushBlock();
+        }
+    });
+    flushBlock();
+    flushBuffer();
+
+    if (failed) {
+        return -1;
+    }
+    qDebug() << "Exported" << rows << "events.";
+    return rows;
+}
+
+qint64 ReportExporter::exportEvents(const QString& filename, const ExportOptions& options) const {
+    QFile file(filename);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qWarning() << "Could not open export file for writing:" << filename;
+        return -1;
+    }
+    const qint64 rows = exportEvents(file, options);
+    file.close();
+    return rows;
+}
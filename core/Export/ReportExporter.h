@@ -0,0 +1,48 @@
+#ifndef REPORTEXPORTER_H
+#define REPORTEXPORTER_H
+
+#include "../../Model/Volunteer.h"
+#include "../../Model/Event.h"
+#include "../../Repository/BaseRepository.h"
+#include "../Snapshot/RepositorySnapshot.h"
+#include <QIODevice>
+#include <QString>
+#include <functional>
+#include <memory>
+
+enum class ExportFormat {
+    Csv,
+    JsonLines
+};
+
+struct ExportOptions {
+    ExportFormat format = ExportFormat::Csv;
+    int blockSize = 4096;        // Events collected before a block is formatted
+    int bufferBytes = 1 << 20;   // Formatted output is written once the buffer reaches this size
+    int threads = 1;             // More than one formats the rows of a block in parallel
+};
+
+// Streams every event joined with the names of its volunteers. Events are read in place
+// from the repository and formatted block by block, so memory use is bounded by the
+// block and buffer sizes plus an id -> name map of the volunteers.
+class ReportExporter {
+public:
+    ReportExporter(const BaseRepository<Volunteer>* volunteerRepo, const BaseRepository<Event>* eventRepo);
+    // Reads published snapshots instead, so the export can run on a worker while the repositories change
+    ReportExporter(std::shared_ptr<const RepositorySnapshot<Volunteer>> volunteers,
+                   std::shared_ptr<const RepositorySnapshot<Event>> events);
+
+    // Return the number of event rows written, or -1 if the output could not be written
+    qint64 exportEvents(QIODevice& out, const ExportOptions& options) const;
+    qint64 exportEvents(const QString& filename, const ExportOptions& options) const;
+
+private:
+    template <typename T>
+    using Source = std::function<void(const std::function<void(const T&)>&)>;
+
+    // Visit every item of the source in storage order; empty when the source is missing
+    Source<Volunteer> m_volunteers;
+    Source<Event> m_events;
+};
+
+#endif // REPORTEXPORTER_H
@@ -0,0 +1,178 @@
+#include "BulkImporter.h"
+#include <QFile>
+#include <QTextStream>
+#include <QStringList>
+#include <QDate>
+#include <QDebug>
+#include <QtConcurrent/QtConcurrent>
+#include <algorithm>
+#include <utility>
+
+namespace {
+
+constexpr std::size_t kChunkSize = 4096;
+
+// Runs check(i) for every index, handing fixed-size chunks to the global thread pool
+template <typename Check>
+void parallelForEachIndex(std::size_t count, Check check) {
+    std::vector<std::pair<std::size_t, std::size_t>> chunks;
+    for (std::size_t begin = 0; begin < count; begin += kChunkSize) {
+        chunks.emplace_back(begin, std::min(begin + kChunkSize, count));
+    }
+    QtConcurrent::blockingMap(chunks, [&check](const std::pair<std::size_t, std::size_t>& chunk) {
+        for (std::size_t i = chunk.first; i < chunk.second; ++i) {
+            check(i);
+        }
+    });
+}
+
+// Fields are stored comma-separated, one record per line
+bool isStorableField(const QString& field) {
+    return !field.trimmed().isEmpty() && !field.contains(',') && !field.contains('\n');
+}
+
+QString checkVolunteerFields(const Volunteer& volunteer) {
+    if (volunteer.getId() <= 0) {
+        return "ID must be positive";
+    }
+    if (!isStorableField(volunteer.getName())) {
+        return "Name is empty or contains a comma";
+    }
+    if (!isStorableField(volunteer.getContactInfo())) {
+        return "Contact info is empty or contains a comma";
+    }
+    return QString();
+}
+
+QString checkEventFields(const Event& event, const QSet<int>& knownVolunteerIds) {
+    if (event.getId() <= 0) {
+        return "ID must be positive";
+    }
+    if (!isStorableField(event.getTitle())) {
+        return "Title is empty or contains a comma";
+    }
+    if (!event.getDate().isValid()) {
+        return "Date is invalid";
+    }
+    if (!isStorableField(event.getLocation())) {
+        return "Location is empty or contains a comma";
+    }
+    for (int volunteerId : event.getVolunteerIds()) {
+        if (!knownVolunteerIds.contains(volunteerId)) {
+            return QString("References unknown volunteer %1").arg(volunteerId);
+        }
+    }
+    return QString();
+}
+
+template <typename T, typename Check>
+std::vector<T> collectValid(const std::vector<T>& items, const QSet<int>& existingIds,
+                            Check checkFields, std::vector<ImportIssue>& issues) {
+    // Each worker writes only its own slots, the shared sets are read-only
+    std::vector<QString> errors(items.size());
+    parallelForEachIndex(items.size(), [&](std::size_t i) {
+        if (existingIds.contains(items[i].getId())) {
+            errors[i] = "ID already exists";
+        } else {
+            errors[i] = checkFields(items[i]);
+        }
+    });
+
+    std::vector<T> accepted;
+    accepted.reserve(items.size());
+    QSet<int> seen;
+    seen.reserve(static_cast<qsizetype>(items.size()));
+    for (std::size_t i = 0; i < items.size(); ++i) {
+        const int id = items[i].getId();
+        if (errors[i].isEmpty() && seen.contains(id)) {
+            errors[i] = "Duplicate ID in import";
+        }
+        if (!errors[i].isEmpty()) {
+            issues.push_back({id, errors[i]});
+            continue;
+        }
+        seen.insert(id);
+        accepted.push_back(items[i]);
+    }
+    return accepted;
+}
+
+QStringList readLines(const QString& filename, std::vector<ImportIssue>& issues) {
+    QStringList lines;
+    QFile file(filename);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        qWarning() << "Could not open import file for reading:" << filename;
+        issues.push_back({-1, QString("Could not open %1").arg(filename)});
+        return lines;
+    }
+    QTextStream in(&file);
+    while (!in.atEnd()) {
+        lines.append(in.readLine());
+    }
+    file.close();
+    return lines;
+}
+
+} // namespace
+
+std::vector<Volunteer> BulkImporter::readVolunteers(const QString& filename, std::vector<ImportIssue>& issues) {
+    std::vector<Volunteer> volunteers;
+    const QStringList lines = readLines(filename, issues);
+    volunteers.reserve(lines.size());
+    for (qsizetype i = 0; i < lines.size(); ++i) {
+        const QStringList parts = lines[i].split(',');
+        bool ok = false;
+        const int id = parts.size() == 3 ? parts[0].toInt(&ok) : 0;
+        if (!ok) {
+            issues.push_back({-1, QString("Malformed volunteer line %1: %2").arg(i + 1).arg(lines[i])});
+            continue;
+        }
+        volunteers.emplace_back(id, parts[1], parts[2]);
+    }
+    return volunteers;
+}
+
+std::vector<Event> BulkImporter::readEvents(const QString& filename, std::vector<ImportIssue>& issues) {
+    std::vector<Event> events;
+    const QStringList lines = readLines(filename, issues);
+    events.reserve(lines.size());
+    for (qsizetype i = 0; i < lines.size(); ++i) {
+        const QStringList parts = lines[i].split(',');
+        bool ok = false;
+        const int id = parts.size() >= 4 ? parts[0].toInt(&ok) : 0;
+        if (!ok) {
+            issues.push_back({-1, QString("Malformed event line %1: %2").arg(i + 1).arg(lines[i])});
+            continue;
+        }
+
+        Event event(id, parts[1], QDate::fromString(parts[2], Qt::ISODate), parts[3]);
+        bool volunteersOk = true;
+        for (qsizetype p = 4; p < parts.size() && volunteersOk; ++p) {
+            const int volunteerId = parts[p].toInt(&volunteersOk);
+            if (volunteersOk) {
+                event.addVolunteer(volunteerId);
+            }
+        }
+        if (!volunteersOk) {
+            issues.push_back({id, QString("Invalid volunteer ID on event line %1").arg(i + 1)});
+            continue;
+        }
+        events.push_back(event);
+    }
+    return events;
+}
+
+std::vector<Volunteer> BulkImporter::validateVolunteers(const std::vector<Volunteer>& volunteers,
+                                                        const QSet<int>& existingIds,
+                                                        std::vector<ImportIssue>& issues) {
+    return collectValid(volunteers, existingIds, checkVolunteerFields, issues);
+}
+
+std::vector<Event> BulkImporter::validateEvents(const std::vector<Event>& events,
+                                                const QSet<int>& existingIds,
+                                                const QSet<int>& knownVolunteerIds,
+                                                std::vector<ImportIssue>& issues) {
+    return collectValid(events, existingIds,
+                        [&knownVolunteerIds](const Event& event) { return checkEventFields(event, knownVolunteerIds); },
+                        issues);
+}
@@ -0,0 +1,47 @@
+#ifndef BULKIMPORTER_H
+#define BULKIMPORTER_H
+
+#include "../../Model/Volunteer.h"
+#include "../../Model/Event.h"
+#include <QString>
+#include <QSet>
+#include <vector>
+
+// A single row rejected during an import
+struct ImportIssue {
+    int id; // -1 when the row could not be parsed at all
+    QString message;
+};
+
+// Whether imported rows keep their own IDs or are given fresh ones by the repository
+enum class ImportIds {
+    Keep,
+    Assign // Never collides with stored IDs, so no existing-ID check is needed
+};
+
+// Outcome of Controller::importVolunteers / Controller::importEvents
+struct ImportResult {
+    int imported = 0;
+    std::vector<ImportIssue> issues;
+
+    bool hasIssues() const { return !issues.empty(); }
+};
+
+class BulkImporter {
+public:
+    // Read rows in the repository CSV layout; malformed lines are reported and skipped
+    static std::vector<Volunteer> readVolunteers(const QString& filename, std::vector<ImportIssue>& issues);
+    static std::vector<Event> readEvents(const QString& filename, std::vector<ImportIssue>& issues);
+
+    // Return the rows that may be inserted. Field and existing-ID checks run in parallel,
+    // duplicates inside the import are caught in a single sequential pass afterwards.
+    static std::vector<Volunteer> validateVolunteers(const std::vector<Volunteer>& volunteers,
+                                                     const QSet<int>& existingIds,
+                                                     std::vector<ImportIssue>& issues);
+    static std::vector<Event> validateEvents(const std::vector<Event>& events,
+                                             const QSet<int>& existingIds,
+                                             const QSet<int>& knownVolunteerIds,
+                                             std::vector<ImportIssue>& issues);
+};
+
+#endif // BULKIMPORTER_H
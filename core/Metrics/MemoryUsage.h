@@ -0,0 +1,89 @@
+#ifndef MEMORYUSAGE_H
+#define MEMORYUSAGE_H
+
+#include "../../Model/Volunteer.h"
+#include "../../Model/Event.h"
+#include <QHash>
+#include <QList>
+#include <QString>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// Estimated bytes held by a collection of entities, split by where they live.
+// Estimates follow Qt 6's container layouts; allocator overhead is not included, and
+// implicitly shared strings are counted once per holder, so shared text is over-reported.
+struct MemoryUsage {
+    std::size_t items = 0;
+    std::size_t objectBytes = 0; // The entity objects themselves, including unused vector capacity
+    std::size_t stringBytes = 0; // QString heap buffers
+    std::size_t listBytes = 0;   // QList heap buffers (event volunteer IDs)
+    std::size_t indexBytes = 0;  // Lookup structures: ID hash, free-ID set
+
+    std::size_t totalBytes() const { return objectBytes + stringBytes + listBytes + indexBytes; }
+
+    MemoryUsage& operator+=(const MemoryUsage& other) {
+        items += other.items;
+        objectBytes += other.objectBytes;
+        stringBytes += other.stringBytes;
+        listBytes += other.listBytes;
+        indexBytes += other.indexBytes;
+        return *this;
+    }
+};
+
+struct MemoryReport {
+    MemoryUsage volunteers;
+    MemoryUsage events;
+    MemoryUsage undoStack; // Entity copies held by commands
+    MemoryUsage redoStack;
+    MemoryUsage indexes; // Controller-side structures: sort keys, date and booking indexes, aggregates,
+                         // the query cache (indexBytes) and snapshot chunks (objectBytes)
+
+    std::size_t totalBytes() const {
+        return volunteers.totalBytes() + events.totalBytes() + undoStack.totalBytes() + redoStack.totalBytes()
+               + indexes.totalBytes();
+    }
+};
+
+// UTF-16 buffer plus the shared-data header; literals and empty strings own no heap
+inline std::size_t stringHeapBytes(const QString& text) {
+    return text.capacity() > 0 ? sizeof(QArrayData) + static_cast<std::size_t>(text.capacity()) * sizeof(QChar) : 0;
+}
+
+template <typename T>
+std::size_t listHeapBytes(const QList<T>& list) {
+    return list.capacity() > 0 ? sizeof(QArrayData) + static_cast<std::size_t>(list.capacity()) * sizeof(T) : 0;
+}
+
+template <typename T>
+std::size_t vectorHeapBytes(const std::vector<T>& items) {
+    return items.capacity() * sizeof(T);
+}
+
+// Qt 6 hashes keep one offset byte per bucket plus node storage for each entry
+template <typename K, typename V>
+std::size_t hashHeapBytes(const QHash<K, V>& hash) {
+    return static_cast<std::size_t>(hash.capacity()) + static_cast<std::size_t>(hash.size()) * sizeof(std::pair<K, V>);
+}
+
+// Heap owned by one entity, excluding the object itself
+inline void addHeapUsage(MemoryUsage& usage, const Volunteer& volunteer) {
+    usage.stringBytes += stringHeapBytes(volunteer.getName()) + stringHeapBytes(volunteer.getContactInfo());
+}
+
+inline void addHeapUsage(MemoryUsage& usage, const Event& event) {
+    usage.stringBytes += stringHeapBytes(event.getTitle()) + stringHeapBytes(event.getLocation());
+    usage.listBytes += listHeapBytes(event.getVolunteerIds());
+}
+
+template <typename T>
+void addVectorUsage(MemoryUsage& usage, const std::vector<T>& items) {
+    usage.items += items.size();
+    usage.objectBytes += items.capacity() * sizeof(T);
+    for (const T& item : items) {
+        addHeapUsage(usage, item);
+    }
+}
+
+#endif // MEMORYUSAGE_H
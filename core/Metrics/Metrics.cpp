@@ -0,0 +1,218 @@
+#include "Metrics.h"
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMutexLocker>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+int LatencyHistogram::bucketFor(quint64 value) {
+    if (value < static_cast<quint64>(kSubBuckets)) {
+        return static_cast<int>(value);
+    }
+    const int msb = static_cast<int>(std::bit_width(value)) - 1;
+    if (msb >= kMaxBits) {
+        return kBucketCount - 1;
+    }
+    const int shift = msb - kSubBucketBits;
+    const int sub = static_cast<int>((value >> shift) & (kSubBuckets - 1));
+    return (msb - kSubBucketBits + 1) * kSubBuckets + sub;
+}
+
+quint64 LatencyHistogram::bucketUpperBound(int bucket) {
+    if (bucket < kSubBuckets) {
+        return static_cast<quint64>(bucket);
+    }
+    const int octave = bucket / kSubBuckets;
+    const int sub = bucket % kSubBuckets;
+    const int shift = octave - 1;
+    const quint64 lower = static_cast<quint64>(kSubBuckets + sub) << shift;
+    return lower + (quint64(1) << shift) - 1;
+}
+
+void LatencyHistogram::record(quint64 nanoseconds) {
+    m_buckets[static_cast<std::size_t>(bucketFor(nanoseconds))].fetch_add(1, std::memory_order_relaxed);
+    m_count.fetch_add(1, std::memory_order_relaxed);
+    m_sum.fetch_add(nanoseconds, std::memory_order_relaxed);
+    quint64 previous = m_max.load(std::memory_order_relaxed);
+    while (nanoseconds > previous && !m_max.compare_exchange_weak(previous, nanoseconds, std::memory_order_relaxed)) {
+    }
+}
+
+quint64 LatencyHistogram::valueAtPercentile(double percentile) const {
+    quint64 total = 0;
+    std::array<quint64, kBucketCount> counts;
+    for (int i = 0; i < kBucketCount; ++i) {
+        counts[static_cast<std::size_t>(i)] = m_buckets[static_cast<std::size_t>(i)].load(std::memory_order_relaxed);
+        total += counts[static_cast<std::size_t>(i)];
+    }
+    if (total == 0) {
+        return 0;
+    }
+
+    const double clamped = std::clamp(percentile, 0.0, 100.0);
+    const quint64 rank = std::max<quint64>(1, static_cast<quint64>(std::ceil(clamped / 100.0 * static_cast<double>(total))));
+    quint64 seen = 0;
+    for (int i = 0; i < kBucketCount; ++i) {
+        seen += counts[static_cast<std::size_t>(i)];
+        if (seen >= rank) {
+            return std::min(bucketUpperBound(i), m_max.load(std::memory_order_relaxed));
+        }
+    }
+    return m_max.load(std::memory_order_relaxed);
+}
+
+HistogramSnapshot LatencyHistogram::snapshot() const {
+    HistogramSnapshot result;
+    result.count = m_count.load(std::memory_order_relaxed);
+    result.sumNs = m_sum.load(std::memory_order_relaxed);
+    result.maxNs = m_max.load(std::memory_order_relaxed);
+    result.p50Ns = valueAtPercentile(50.0);
+    result.p90Ns = valueAtPercentile(90.0);
+    result.p99Ns = valueAtPercentile(99.0);
+    result.p999Ns = valueAtPercentile(99.9);
+    return result;
+}
+
+void LatencyHistogram::reset() {
+    for (auto& bucket : m_buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    m_count.store(0, std::memory_order_relaxed);
+    m_sum.store(0, std::memory_order_relaxed);
+    m_max.store(0, std::memory_order_relaxed);
+}
+
+MetricsRegistry& MetricsRegistry::instance() {
+    static MetricsRegistry registry;
+    return registry;
+}
+
+Counter& MetricsRegistry::counter(const QString& name) {
+    QMutexLocker locker(&m_mutex);
+    std::unique_ptr<Counter>& slot = m_counters[name];
+    if (!slot) {
+        slot = std::make_unique<Counter>();
+    }
+    return *slot;
+}
+
+LatencyHistogram& MetricsRegistry::histogram(const QString& name) {
+    QMutexLocker locker(&m_mutex);
+    std::unique_ptr<LatencyHistogram>& slot = m_histograms[name];
+    if (!slot) {
+        slot = std::make_unique<LatencyHistogram>();
+    }
+    return *slot;
+}
+
+Gauge& MetricsRegistry::gauge(const QString& name) {
+    QMutexLocker locker(&m_mutex);
+    std::unique_ptr<Gauge>& slot = m_gauges[name];
+    if (!slot) {
+        slot = std::make_unique<Gauge>();
+    }
+    return *slot;
+}
+
+MetricsSnapshot MetricsRegistry::snapshot() const {
+    MetricsSnapshot result;
+    result.takenAt = QDateTime::currentDateTimeUtc();
+    QMutexLocker locker(&m_mutex);
+    for (const auto& [name, counter] : m_counters) {
+        result.counters.insert(name, counter->value());
+    }
+    for (const auto& [name, histogram] : m_histograms) {
+        result.histograms.insert(name, histogram->snapshot());
+    }
+    for (const auto& [name, gauge] : m_gauges) {
+        result.gauges.insert(name, gauge->value());
+    }
+    return result;
+}
+
+void MetricsRegistry::reset() {
+    QMutexLocker locker(&m_mutex);
+    for (auto& entry : m_counters) {
+        entry.second->reset();
+    }
+    for (auto& entry : m_histograms) {
+        entry.second->reset();
+    }
+    for (auto& entry : m_gauges) {
+        entry.second->reset();
+    }
+}
+
+QByteArray MetricsSnapshot::toJson() const {
+    QJsonObject counterObject;
+    for (auto it = counters.constBegin(); it != counters.constEnd(); ++it) {
+        counterObject.insert(it.key(), static_cast<qint64>(it.value()));
+    }
+    QJsonObject gaugeObject;
+    for (auto it = gauges.constBegin(); it != gauges.constEnd(); ++it) {
+        gaugeObject.insert(it.key(), it.value());
+    }
+    QJsonObject histogramObject;
+    for (auto it = histograms.constBegin(); it != histograms.constEnd(); ++it) {
+        const HistogramSnapshot& h = it.value();
+        QJsonObject entry;
+        entry.insert("count", static_cast<qint64>(h.count));
+        entry.insert("sum_ns", static_cast<qint64>(h.sumNs));
+        entry.insert("mean_ns", h.meanNs());
+        entry.insert("max_ns", static_cast<qint64>(h.maxNs));
+        entry.insert("p50_ns", static_cast<qint64>(h.p50Ns));
+        entry.insert("p90_ns", static_cast<qint64>(h.p90Ns));
+        entry.insert("p99_ns", static_cast<qint64>(h.p99Ns));
+        entry.insert("p999_ns", static_cast<qint64>(h.p999Ns));
+        histogramObject.insert(it.key(), entry);
+    }
+
+    QJsonObject root;
+    root.insert("timestamp", takenAt.toString(Qt::ISODateWithMs));
+    root.insert("counters", counterObject);
+    root.insert("gauges", gaugeObject);
+    root.insert("histograms", histogramObject);
+    return QJsonDocument(root).toJson(QJsonDocument::Indented);
+}
+
+// "controller.add_event" -> "volunteer_controller_add_event"
+static QByteArray prometheusName(const QString& name) {
+    QByteArray result = "volunteer_";
+    for (QChar c : name) {
+        result.append(c.isLetterOrNumber() ? c.toLatin1() : '_');
+    }
+    return result;
+}
+
+QByteArray MetricsSnapshot::toPrometheus() const {
+    QByteArray out;
+    for (auto it = counters.constBegin(); it != counters.constEnd(); ++it) {
+        const QByteArray name = prometheusName(it.key()) + "_total";
+        out += "# TYPE " + name + " counter\n";
+        out += name + ' ' + QByteArray::number(it.value()) + '\n';
+    }
+    for (auto it = gauges.constBegin(); it != gauges.constEnd(); ++it) {
+        const QByteArray name = prometheusName(it.key());
+        out += "# TYPE " + name + " gauge\n";
+        out += name + ' ' + QByteArray::number(it.value()) + '\n';
+    }
+    for (auto it = histograms.constBegin(); it != histograms.constEnd(); ++it) {
+        const HistogramSnapshot& h = it.value();
+        const QByteArray name = prometheusName(it.key()) + "_seconds";
+        auto seconds = [](quint64 ns) { return QByteArray::number(static_cast<double>(ns) / 1e9, 'g', 9); };
+        out += "# TYPE " + name + " summary\n";
+        out += name + "{quantile=\"0.5\"} " + seconds(h.p50Ns) + '\n';
+        out += name + "{quantile=\"0.9\"} " + seconds(h.p90Ns) + '\n';
+        out += name + "{quantile=\"0.99\"} " + seconds(h.p99Ns) + '\n';
+        out += name + "{quantile=\"0.999\"} " + seconds(h.p999Ns) + '\n';
+        out += name + "_sum " + seconds(h.sumNs) + '\n';
+        out += name + "_count " + QByteArray::number(h.count) + '\n';
+    }
+    return out;
+}
+
+QByteArray MetricsSnapshot::format(MetricsFormat format) const {
+    return format == MetricsFormat::Json ? toJson() : toPrometheus();
+}
@@ -0,0 +1,142 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <QByteArray>
+#include <QDateTime>
+#include <QElapsedTimer>
+#include <QMap>
+#include <QMutex>
+#include <QString>
+#include <array>
+#include <atomic>
+#include <map>
+#include <memory>
+
+// Monotonic event count; increments are a single relaxed atomic add
+class Counter {
+public:
+    void increment(quint64 by = 1) { m_value.fetch_add(by, std::memory_order_relaxed); }
+    quint64 value() const { return m_value.load(std::memory_order_relaxed); }
+    void reset() { m_value.store(0, std::memory_order_relaxed); }
+
+private:
+    std::atomic<quint64> m_value{0};
+};
+
+// Last value set, e.g. a size sampled when a snapshot is taken
+class Gauge {
+public:
+    void set(qint64 value) { m_value.store(value, std::memory_order_relaxed); }
+    qint64 value() const { return m_value.load(std::memory_order_relaxed); }
+    void reset() { m_value.store(0, std::memory_order_relaxed); }
+
+private:
+    std::atomic<qint64> m_value{0};
+};
+
+struct HistogramSnapshot {
+    quint64 count = 0;
+    quint64 sumNs = 0;
+    quint64 maxNs = 0;
+    quint64 p50Ns = 0;
+    quint64 p90Ns = 0;
+    quint64 p99Ns = 0;
+    quint64 p999Ns = 0;
+
+    double meanNs() const { return count ? static_cast<double>(sumNs) / static_cast<double>(count) : 0.0; }
+};
+
+// HDR-style latency histogram: each power of two is split into 16 linear sub-buckets,
+// so any recorded value is reported within 1/16 (6.25%) of its true value.
+// Recording is lock-free; a snapshot taken while writers run may be off by the in-flight samples.
+class LatencyHistogram {
+public:
+    void record(quint64 nanoseconds);
+    // Upper bound of the bucket holding the given percentile (0-100), capped at the maximum seen
+    quint64 valueAtPercentile(double percentile) const;
+    HistogramSnapshot snapshot() const;
+    void reset();
+
+    static constexpr int kSubBucketBits = 4;
+    static constexpr int kSubBuckets = 1 << kSubBucketBits;
+    static constexpr int kMaxBits = 44; // ~4.9 hours in nanoseconds; longer samples land in the last bucket
+    static constexpr int kBucketCount = (kMaxBits - kSubBucketBits + 1) * kSubBuckets;
+
+    static int bucketFor(quint64 value);
+    static quint64 bucketUpperBound(int bucket);
+
+private:
+    std::array<std::atomic<quint64>, kBucketCount> m_buckets{};
+    std::atomic<quint64> m_count{0};
+    std::atomic<quint64> m_sum{0};
+    std::atomic<quint64> m_max{0};
+};
+
+enum class MetricsFormat {
+    Json,
+    Prometheus // Text exposition format
+};
+
+struct MetricsSnapshot {
+    QDateTime takenAt;
+    QMap<QString, quint64> counters;
+    QMap<QString, qint64> gauges;
+    QMap<QString, HistogramSnapshot> histograms;
+
+    QByteArray toJson() const;
+    QByteArray toPrometheus() const;
+    QByteArray format(MetricsFormat format) const;
+};
+
+// Process-wide named metrics. Registration takes a lock; the returned references stay valid for
+// the life of the process, so call sites look them up once and record without locking.
+class MetricsRegistry {
+public:
+    static MetricsRegistry& instance();
+
+    Counter& counter(const QString& name);
+    LatencyHistogram& histogram(const QString& name);
+    Gauge& gauge(const QString& name);
+
+    MetricsSnapshot snapshot() const;
+    // Zeroes every metric but keeps the registrations (and so the references callers hold)
+    void reset();
+
+private:
+    MetricsRegistry() = default;
+
+    mutable QMutex m_mutex;
+    std::map<QString, std::unique_ptr<Counter>> m_counters;
+    std::map<QString, std::unique_ptr<LatencyHistogram>> m_histograms;
+    std::map<QString, std::unique_ptr<Gauge>> m_gauges;
+};
+
+// Records the time from construction to destruction into a histogram
+class ScopedLatency {
+public:
+    explicit ScopedLatency(LatencyHistogram& histogram) : m_histogram(histogram) { m_timer.start(); }
+    ~ScopedLatency() { m_histogram.record(static_cast<quint64>(m_timer.nsecsElapsed())); }
+
+    ScopedLatency(const ScopedLatency&) = delete;
+    ScopedLatency& operator=(const ScopedLatency&) = delete;
+
+private:
+    LatencyHistogram& m_histogram;
+    QElapsedTimer m_timer;
+};
+
+#define METRICS_CONCAT_INNER(a, b) a##b
+#define METRICS_CONCAT(a, b) METRICS_CONCAT_INNER(a, b)
+
+// Times the rest of the enclosing scope under name; the registry lookup happens once per call site
+#define METRIC_LATENCY(name) \
+    static LatencyHistogram& METRICS_CONCAT(metricHistogram_, __LINE__) = MetricsRegistry::instance().histogram(name); \
+    ScopedLatency METRICS_CONCAT(metricLatency_, __LINE__)(METRICS_CONCAT(metricHistogram_, __LINE__))
+
+#define METRIC_COUNT(name) \
+    do { \
+        static Counter& metricCounter = MetricsRegistry::instance().counter(name); \
+        metricCounter.increment(); \
+    } while (false)
+
+#endif // METRICS_H
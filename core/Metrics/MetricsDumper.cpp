@@ -0,0 +1,40 @@
+#include "MetricsDumper.h"
+#include <QDebug>
+#include <QSaveFile>
+
+MetricsDumper::MetricsDumper(const QString& filename, MetricsFormat format, int intervalMs, QObject* parent)
+    : QObject(parent), m_filename(filename), m_format(format) {
+    m_timer.setInterval(intervalMs);
+    connect(&m_timer, &QTimer::timeout, this, [this]() { dumpNow(); });
+}
+
+MetricsDumper::~MetricsDumper() {
+    if (m_timer.isActive()) {
+        dumpNow(); // Keep the final numbers
+    }
+}
+
+void MetricsDumper::start() {
+    m_timer.start();
+}
+
+void MetricsDumper::stop() {
+    m_timer.stop();
+}
+
+bool MetricsDumper::dumpNow() const {
+    if (m_beforeDump) {
+        m_beforeDump();
+    }
+    QSaveFile file(m_filename);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "Could not open metrics file for writing:" << m_filename;
+        return false;
+    }
+    file.write(MetricsRegistry::instance().snapshot().format(m_format));
+    if (!file.commit()) {
+        qWarning() << "Could not write metrics file:" << m_filename;
+        return false;
+    }
+    return true;
+}
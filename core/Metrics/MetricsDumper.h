@@ -0,0 +1,32 @@
+#ifndef METRICSDUMPER_H
+#define METRICSDUMPER_H
+
+#include "Metrics.h"
+#include <QObject>
+#include <QTimer>
+#include <functional>
+
+// Rewrites a local file with the current metrics on a timer. Each dump replaces the file
+// atomically, so a scraper or tail never sees a partial write. Needs a running event loop.
+class MetricsDumper : public QObject {
+    Q_OBJECT
+public:
+    MetricsDumper(const QString& filename, MetricsFormat format, int intervalMs, QObject* parent = nullptr);
+    ~MetricsDumper() override;
+
+    void start();
+    void stop();
+    bool dumpNow() const;
+    // Runs before each dump, e.g. to refresh gauges that are sampled rather than recorded
+    void setBeforeDump(std::function<void()> callback) { m_beforeDump = std::move(callback); }
+
+    QString filename() const { return m_filename; }
+
+private:
+    QString m_filename;
+    MetricsFormat m_format;
+    QTimer m_timer;
+    std::function<void()> m_beforeDump;
+};
+
+#endif // METRICSDUMPER_H
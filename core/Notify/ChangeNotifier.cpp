@@ -0,0 +1,52 @@
+#include "ChangeNotifier.h"
+#include <QSet>
+
+ChangeNotifier::ChangeNotifier(QObject* parent)
+    : QObject(parent) {
+}
+
+void ChangeNotifier::onAdded(const Volunteer& volunteer) {
+    emit volunteerAdded(volunteer);
+}
+
+void ChangeNotifier::onRemoved(const Volunteer& volunteer) {
+    emit volunteerRemoved(volunteer);
+}
+
+void ChangeNotifier::onUpdated(const Volunteer& oldVolunteer, const Volunteer& newVolunteer) {
+    emit volunteerUpdated(oldVolunteer, newVolunteer);
+}
+
+void ChangeNotifier::onAdded(const Event& event) {
+    emit eventAdded(event);
+}
+
+void ChangeNotifier::onRemoved(const Event& event) {
+    emit eventRemoved(event);
+}
+
+void ChangeNotifier::onUpdated(const Event& oldEvent, const Event& newEvent) {
+    emit eventUpdated(oldEvent, newEvent);
+
+    const QList<int> oldVolunteers = oldEvent.getVolunteerIds();
+    const QList<int> newVolunteers = newEvent.getVolunteerIds();
+    if (oldVolunteers == newVolunteers) {
+        return;
+    }
+    const QSet<int> before(oldVolunteers.begin(), oldVolunteers.end());
+    const QSet<int> after(newVolunteers.begin(), newVolunteers.end());
+    for (int volunteerId : oldVolunteers) {
+        if (!after.contains(volunteerId)) {
+            emit volunteerUnassigned(newEvent.getId(), volunteerId);
+        }
+    }
+    for (int volunteerId : newVolunteers) {
+        if (!before.contains(volunteerId)) {
+            emit volunteerAssigned(newEvent.getId(), volunteerId);
+        }
+    }
+}
+
+void ChangeNotifier::onBatchCommitted(std::size_t changeCount) {
+    emit batchCommitted(static_cast<int>(changeCount));
+}
@@ -0,0 +1,46 @@
+#ifndef CHANGENOTIFIER_H
+#define CHANGENOTIFIER_H
+
+#include <QObject>
+#include "../../Model/Volunteer.h"
+#include "../../Model/Event.h"
+#include "../../Repository/RepositoryObserver.h"
+
+// Qt-signal facade over both repositories. Every stored change, including undo/redo and
+// imports, is emitted as a typed delta so views and caches can update in O(changes).
+class ChangeNotifier : public QObject,
+                       public RepositoryObserver<Volunteer>,
+                       public RepositoryObserver<Event> {
+    Q_OBJECT
+
+public:
+    explicit ChangeNotifier(QObject* parent = nullptr);
+
+    void onAdded(const Volunteer& volunteer) override;
+    void onRemoved(const Volunteer& volunteer) override;
+    void onUpdated(const Volunteer& oldVolunteer, const Volunteer& newVolunteer) override;
+
+    void onAdded(const Event& event) override;
+    void onRemoved(const Event& event) override;
+    void onUpdated(const Event& oldEvent, const Event& newEvent) override;
+
+    void onBatchCommitted(std::size_t changeCount) override;
+
+signals:
+    void volunteerAdded(const Volunteer& volunteer);
+    void volunteerRemoved(const Volunteer& volunteer);
+    void volunteerUpdated(const Volunteer& oldVolunteer, const Volunteer& newVolunteer);
+
+    void eventAdded(const Event& event);
+    void eventRemoved(const Event& event);
+    void eventUpdated(const Event& oldEvent, const Event& newEvent);
+
+    // Emitted after eventUpdated for each volunteer that joined or left the event
+    void volunteerAssigned(int eventId, int volunteerId);
+    void volunteerUnassigned(int eventId, int volunteerId);
+
+    // Emitted once after a batch import or its undo, after the per-item signals
+    void batchCommitted(int changeCount);
+};
+
+#endif // CHANGENOTIFIER_H
@@ -0,0 +1,106 @@
+#ifndef COLLATIONINDEX_H
+#define COLLATIONINDEX_H
+
+#include "../../Repository/BaseRepository.h"
+#include "../../Repository/RepositoryObserver.h"
+#include "../Metrics/MemoryUsage.h"
+#include <QCollator>
+#include <QCollatorSortKey>
+#include <QString>
+#include <functional>
+#include <utility>
+#include <unordered_map>
+
+// Locale-aware sort keys for one text field of every item, keyed by id.
+// Built lazily on the first sorted query, then kept current through repository notifications.
+template <typename T>
+class CollationIndex : public RepositoryObserver<T> {
+public:
+    using FieldFunction = std::function<QString(const T&)>;
+
+    // fieldFlags: the patch flags that can change the field; patches without them leave the key alone
+    explicit CollationIndex(FieldFunction field, std::uint32_t fieldFlags = ~std::uint32_t(0))
+        : m_field(std::move(field)), m_fieldFlags(fieldFlags) {
+        m_collator.setCaseSensitivity(Qt::CaseInsensitive);
+        m_collator.setNumericMode(true);
+    }
+
+    bool isBuilt() const {
+        return m_built;
+    }
+
+    void build(const BaseRepository<T>& repository) {
+        m_keys.clear();
+        m_keyBytes = 0;
+        repository.forEach([this](const T& item) { insert(item); });
+        m_built = true;
+    }
+
+    const QCollatorSortKey* find(int id) const {
+        auto it = m_keys.find(id);
+        return it != m_keys.end() ? &it->second.key : nullptr;
+    }
+
+    // Estimated heap held by the keys: hash nodes and buckets, plus key data sized as the UTF-16 text
+    // it was made from, since QCollatorSortKey does not expose its own buffer
+    std::size_t memoryBytes() const {
+        return m_keys.bucket_count() * sizeof(void*)
+               + m_keys.size() * (sizeof(std::pair<const int, Key>) + 2 * sizeof(void*))
+               + m_keyBytes;
+    }
+
+    void onAdded(const T& item) override {
+        if (m_built) {
+            insert(item);
+        }
+    }
+
+    void onRemoved(const T& item) override {
+        if (m_built) {
+            erase(item.getId());
+        }
+    }
+
+    void onUpdated(const T& oldItem, const T& newItem) override {
+        if (m_built && m_field(oldItem) != m_field(newItem)) {
+            insert(newItem);
+        }
+    }
+
+    void onPatched(const T& oldItem, const T& newItem, std::uint32_t changedFields) override {
+        if (changedFields & m_fieldFlags) {
+            onUpdated(oldItem, newItem);
+        }
+    }
+
+private:
+    struct Key {
+        QCollatorSortKey key;
+        std::size_t bytes; // Estimated key data
+    };
+
+    void insert(const T& item) {
+        const QString text = m_field(item);
+        erase(item.getId());
+        const std::size_t bytes = static_cast<std::size_t>(text.size()) * sizeof(QChar);
+        m_keys.insert_or_assign(item.getId(), Key{m_collator.sortKey(text), bytes});
+        m_keyBytes += bytes;
+    }
+
+    void erase(int id) {
+        auto it = m_keys.find(id);
+        if (it != m_keys.end()) {
+            m_keyBytes -= it->second.bytes;
+            m_keys.erase(it);
+        }
+    }
+
+    FieldFunction m_field;
+    std::uint32_t m_fieldFlags;
+    QCollator m_collator;
+    bool m_built = false;
+    std::unordered_map<int, Key> m_keys;
+    std::size_t m_keyBytes = 0;
+};
+
+#endif // COLLATIONINDEX_H
@@ -0,0 +1,69 @@
+#include "EventDateIndex.h"
+#include <limits>
+
+bool EventDateIndex::isBuilt() const {
+    return m_built;
+}
+
+void EventDateIndex::build(const BaseRepository<Event>& repository) {
+    m_entries.clear();
+    repository.forEach([this](const Event& event) { insert(event); });
+    m_built = true;
+}
+
+std::vector<int> EventDateIndex::upcoming(const QDate& from, int n) const {
+    std::vector<int> ids;
+    if (n <= 0) {
+        return ids;
+    }
+    ids.reserve(static_cast<std::size_t>(n));
+    const qint64 firstDay = from.isValid() ? from.toJulianDay() : std::numeric_limits<qint64>::min();
+    for (auto it = m_entries.lower_bound({firstDay, std::numeric_limits<int>::min()});
+         it != m_entries.end() && static_cast<int>(ids.size()) < n; ++it) {
+        ids.push_back(it->second);
+    }
+    return ids;
+}
+
+std::size_t EventDateIndex::memoryBytes() const {
+    return m_entries.size() * (sizeof(Entry) + 4 * sizeof(void*));
+}
+
+void EventDateIndex::onAdded(const Event& event) {
+    if (m_built) {
+        insert(event);
+    }
+}
+
+void EventDateIndex::onRemoved(const Event& event) {
+    if (m_built) {
+        erase(event);
+    }
+}
+
+void EventDateIndex::onUpdated(const Event& oldEvent, const Event& newEvent) {
+    if (m_built && oldEvent.getDate() != newEvent.getDate()) {
+        erase(oldEvent);
+        insert(newEvent);
+    }
+}
+
+// Only the date places an event in the index
+void EventDateIndex::onPatched(const Event& oldEvent, const Event& newEvent, std::uint32_t changedFields) {
+    if (EventFields::fromInt(changedFields).testFlag(EventField::Date)) {
+        onUpdated(oldEvent, newEvent);
+    }
+}
+
+void EventDateIndex::insert(const Event& event) {
+    // Undated events never show up as upcoming
+    if (event.getDate().isValid()) {
+        m_entries.emplace(event.getDate().toJulianDay(), event.getId());
+    }
+}
+
+void EventDateIndex::erase(const Event& event) {
+    if (event.getDate().isValid()) {
+        m_entries.erase({event.getDate().toJulianDay(), event.getId()});
+    }
+}
@@ -0,0 +1,40 @@
+#ifndef EVENTDATEINDEX_H
+#define EVENTDATEINDEX_H
+
+#include "../../Model/Event.h"
+#include "../../Model/EventFields.h"
+#include "../../Repository/BaseRepository.h"
+#include "../../Repository/RepositoryObserver.h"
+#include <QDate>
+#include <set>
+#include <utility>
+#include <vector>
+
+// Events ordered by (date, id). Built lazily from the repository on first use and
+// then kept current through repository notifications, including undo/redo.
+class EventDateIndex : public RepositoryObserver<Event> {
+public:
+    bool isBuilt() const;
+    void build(const BaseRepository<Event>& repository);
+
+    // Ids of at most n events dated on or after from, earliest first: O(log N + n)
+    std::vector<int> upcoming(const QDate& from, int n) const;
+    // Estimated heap held by the index: one tree node per event
+    std::size_t memoryBytes() const;
+
+    void onAdded(const Event& event) override;
+    void onRemoved(const Event& event) override;
+    void onUpdated(const Event& oldEvent, const Event& newEvent) override;
+    void onPatched(const Event& oldEvent, const Event& newEvent, std::uint32_t changedFields) override;
+
+private:
+    using Entry = std::pair<qint64, int>; // Julian day, event id
+
+    void insert(const Event& event);
+    void erase(const Event& event);
+
+    bool m_built = false;
+    std::set<Entry> m_entries;
+};
+
+#endif // EVENTDATEINDEX_H
@@ -0,0 +1,69 @@
+#include "Query.h"
+#include "../Trace/Trace.h"
+
+bool EventFilter::matches(const Event& event) const {
+    if (!titleContains.isEmpty() && !event.getTitle().contains(titleContains, Qt::CaseInsensitive)) {
+        return false;
+    }
+    if (!locationContains.isEmpty() && !event.getLocation().contains(locationContains, Qt::CaseInsensitive)) {
+        return false;
+    }
+    if (from.isValid() && event.getDate() < from) {
+        return false;
+    }
+    if (to.isValid() && event.getDate() > to) {
+        return false;
+    }
+    return true;
+}
+
+QString EventFilter::cacheKey() const {
+    // Matching is case-insensitive, so case-folded text gives one key per distinct result.
+    // The unit separator cannot appear in typed text.
+    const QChar separator(0x1F);
+    return titleContains.toCaseFolded() + separator + locationContains.toCaseFolded() + separator
+           + from.toString(Qt::ISODate) + separator + to.toString(Qt::ISODate);
+}
+
+std::optional<std::vector<int>> filterEventIds(const std::vector<Event>& events, const EventFilter& filter,
+                                               const std::function<bool()>& isCancelled) {
+    TRACE_SCOPE("query", "filterEventIds");
+    constexpr std::size_t pollInterval = 4096;
+    std::vector<int> ids;
+    for (std::size_t i = 0; i < events.size(); ++i) {
+        if (i % pollInterval == 0 && isCancelled && isCancelled()) {
+            return std::nullopt;
+        }
+        if (filter.matches(events[i])) {
+            ids.push_back(events[i].getId());
+        }
+    }
+    return ids;
+}
+
+std::optional<std::vector<int>> filterEventIds(const RepositorySnapshot<Event>& events, const EventFilter& filter,
+                                               const std::function<bool()>& isCancelled) {
+    TRACE_SCOPE("query", "filterEventIds");
+    std::vector<int> ids;
+    for (std::size_t c = 0; c < events.chunkCount(); ++c) {
+        if (isCancelled && isCancelled()) {
+            return std::nullopt;
+        }
+        for (const Event& event : events.chunk(c)) {
+            if (filter.matches(event)) {
+                ids.push_back(event.getId());
+            }
+        }
+    }
+    return ids;
+}
+
+bool VolunteerFilter::matches(const Volunteer& volunteer) const {
+    if (!nameContains.isEmpty() && !volunteer.getName().contains(nameContains, Qt::CaseInsensitive)) {
+        return false;
+    }
+    if (!contactContains.isEmpty() && !volunteer.getContactInfo().contains(contactContains, Qt::CaseInsensitive)) {
+        return false;
+    }
+    return true;
+}
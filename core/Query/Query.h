@@ -0,0 +1,101 @@
+#ifndef QUERY_H
+#define QUERY_H
+
+#include "../../Model/Volunteer.h"
+#include "../../Model/Event.h"
+#include "../Snapshot/RepositorySnapshot.h"
+#include <QString>
+#include <QDate>
+#include <QCollatorSortKey>
+#include <vector>
+#include <algorithm>
+#include <optional>
+#include <functional>
+
+enum class SortOrder {
+    Ascending,
+    Descending
+};
+
+enum class EventSortKey {
+    Id,
+    Title,
+    Date,
+    Location
+};
+
+enum class VolunteerSortKey {
+    Id,
+    Name,
+    ContactInfo
+};
+
+// Empty strings and invalid dates leave that criterion unrestricted
+struct EventFilter {
+    QString titleContains;
+    QString locationContains;
+    QDate from;
+    QDate to;
+
+    bool matches(const Event& event) const;
+    // Normalized form for result caching: filters with equal keys match the same events
+    QString cacheKey() const;
+};
+
+// IDs of the matching events in storage order. isCancelled is polled every few thousand
+// rows so a scan superseded by a newer query stops early; a cancelled scan returns nullopt.
+std::optional<std::vector<int>> filterEventIds(const std::vector<Event>& events, const EventFilter& filter,
+                                               const std::function<bool()>& isCancelled);
+// The same scan over a published snapshot, polling isCancelled between chunks
+std::optional<std::vector<int>> filterEventIds(const RepositorySnapshot<Event>& events, const EventFilter& filter,
+                                               const std::function<bool()>& isCancelled);
+
+struct VolunteerFilter {
+    QString nameContains;
+    QString contactContains;
+
+    bool matches(const Volunteer& volunteer) const;
+};
+
+template <typename T>
+struct QueryPage {
+    std::vector<T> items;
+    int total = 0; // Number of matching items before pagination
+};
+
+// A matching item together with its precomputed collation key (if the sort uses one)
+template <typename T>
+struct SortCandidate {
+    const T* item;
+    const QCollatorSortKey* key;
+};
+
+// Copies out positions [offset, offset + limit) of the candidates ordered by less.
+// Only the requested window is sorted: nth_element skips the first offset candidates
+// and partial_sort orders the page, so a first page costs O(N log limit).
+// A negative limit returns everything from offset on.
+template <typename T, typename Less>
+std::vector<T> selectPage(std::vector<SortCandidate<T>>& candidates, int offset, int limit,
+                          SortOrder order, Less less) {
+    auto ordered = [&](const SortCandidate<T>& a, const SortCandidate<T>& b) {
+        return order == SortOrder::Ascending ? less(a, b) : less(b, a);
+    };
+
+    const std::size_t begin = std::min(static_cast<std::size_t>(std::max(offset, 0)), candidates.size());
+    const std::size_t end = limit < 0 ? candidates.size()
+                                      : std::min(candidates.size(), begin + static_cast<std::size_t>(limit));
+
+    if (begin > 0 && begin < candidates.size()) {
+        std::nth_element(candidates.begin(), candidates.begin() + begin, candidates.end(), ordered);
+    }
+    std::partial_sort(candidates.begin() + begin, candidates.begin() + end, candidates.end(), ordered);
+
+    std::vector<T> items;
+    items.reserve(end - begin);
+    for (std::size_t i = begin; i < end; ++i) {
+        items.push_back(*candidates[i].item);
+    }
+    return items;
+}
+
+#endif // QUERY_H
@@ -0,0 +1,130 @@
+#ifndef QUERYCACHE_H
+#define QUERYCACHE_H
+
+#include "../Metrics/MemoryUsage.h"
+#include "../Metrics/Metrics.h"
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QString>
+#include <cstdint>
+#include <list>
+#include <memory>
+
+// Bounded LRU cache of query results keyed by a normalized query string. Each result is tagged with
+// the repository generation it was computed at; a lookup under a newer generation is a miss and drops
+// the entry, so writes never have to visit the cache. Hits, misses and evictions are counted in the
+// metrics registry as <name>.hits, <name>.misses and <name>.evictions. Thread-safe.
+template <typename Value>
+class QueryCache {
+public:
+    QueryCache(const QString& metricName, std::size_t capacity)
+        : m_capacity(capacity),
+          m_hits(MetricsRegistry::instance().counter(metricName + ".hits")),
+          m_misses(MetricsRegistry::instance().counter(metricName + ".misses")),
+          m_evictions(MetricsRegistry::instance().counter(metricName + ".evictions")),
+          m_entries(MetricsRegistry::instance().gauge(metricName + ".entries")) {}
+
+    // The cached result for key if it was computed at generation, else nullptr
+    std::shared_ptr<const Value> find(const QString& key, std::uint64_t generation) {
+        QMutexLocker locker(&m_mutex);
+        auto pos = m_index.find(key);
+        if (pos == m_index.end()) {
+            m_misses.increment();
+            return nullptr;
+        }
+        auto entry = *pos;
+        if (entry->generation != generation) {
+            m_lru.erase(entry);
+            m_index.erase(pos);
+            m_entries.set(static_cast<qint64>(m_lru.size()));
+            m_misses.increment();
+            return nullptr;
+        }
+        m_lru.splice(m_lru.begin(), m_lru, entry); // Most recently used first
+        m_hits.increment();
+        return entry->value;
+    }
+
+    // Stores a result computed at generation, evicting the least recently used entry when full
+    void insert(const QString& key, std::uint64_t generation, std::shared_ptr<const Value> value) {
+        QMutexLocker locker(&m_mutex);
+        if (m_capacity == 0) {
+            return;
+        }
+        auto pos = m_index.find(key);
+        if (pos != m_index.end()) {
+            m_lru.erase(*pos);
+            m_index.erase(pos);
+        }
+        m_lru.push_front({key, generation, std::move(value)});
+        m_index.insert(key, m_lru.begin());
+        evictOverflow();
+        m_entries.set(static_cast<qint64>(m_lru.size()));
+    }
+
+    void setCapacity(std::size_t capacity) {
+        QMutexLocker locker(&m_mutex);
+        m_capacity = capacity;
+        evictOverflow();
+        m_entries.set(static_cast<qint64>(m_lru.size()));
+    }
+
+    std::size_t capacity() const {
+        QMutexLocker locker(&m_mutex);
+        return m_capacity;
+    }
+
+    std::size_t size() const {
+        QMutexLocker locker(&m_mutex);
+        return m_lru.size();
+    }
+
+    // Estimated heap held by the cache: list nodes, keys, the key hash and every cached result,
+    // counted here even while a reader still shares it
+    std::size_t memoryBytes() const {
+        QMutexLocker locker(&m_mutex);
+        std::size_t bytes = hashHeapBytes(m_index);
+        for (const Entry& entry : m_lru) {
+            bytes += sizeof(Entry) + 2 * sizeof(void*) + stringHeapBytes(entry.key);
+            if (entry.value) {
+                bytes += sizeof(Value) + vectorHeapBytes(*entry.value);
+            }
+        }
+        return bytes;
+    }
+
+    void clear() {
+        QMutexLocker locker(&m_mutex);
+        m_lru.clear();
+        m_index.clear();
+        m_entries.set(0);
+    }
+
+private:
+    struct Entry {
+        QString key;
+        std::uint64_t generation;
+        std::shared_ptr<const Value> value;
+    };
+    using EntryList = std::list<Entry>;
+
+    void evictOverflow() {
+        while (m_lru.size() > m_capacity) {
+            m_index.remove(m_lru.back().key);
+            m_lru.pop_back();
+            m_evictions.increment();
+        }
+    }
+
+    mutable QMutex m_mutex;
+    std::size_t m_capacity;
+    EntryList m_lru;
+    QHash<QString, typename EntryList::iterator> m_index;
+    Counter& m_hits;
+    Counter& m_misses;
+    Counter& m_evictions;
+    Gauge& m_entries;
+};
+
+#endif // QUERYCACHE_H
@@ -0,0 +1,285 @@
+#include "OperationLog.h"
+#include <QDebug>
+
+namespace {
+
+constexpr quint32 kMagic = 0x564F504C; // "VOPL"
+constexpr quint16 kVersion = 1;
+
+void writeString(QDataStream& out, const QString& text) {
+    out << text.toUtf8();
+}
+
+QString readString(QDataStream& in) {
+    QByteArray utf8;
+    in >> utf8;
+    return QString::fromUtf8(utf8);
+}
+
+bool carriesEvent(OperationType type) {
+    return type == OperationType::AddEvent || type == OperationType::UpdateEvent
+           || type == OperationType::UpdateEventFields;
+}
+
+void writeEvent(QDataStream& out, const Event& event) {
+    out << qint32(event.getId());
+    writeString(out, event.getTitle());
+    writeString(out, event.getLocation());
+    out << qint64(event.getDate().toJulianDay()) << event.getVolunteerIds();
+}
+
+Event readEvent(QDataStream& in) {
+    qint32 id = 0;
+    in >> id;
+    const QString title = readString(in);
+    const QString location = readString(in);
+    qint64 julianDay = 0;
+    QList<int> volunteerIds;
+    in >> julianDay >> volunteerIds;
+    return Event(id, title, QDate::fromJulianDay(julianDay), location, volunteerIds);
+}
+
+} // namespace
+
+const char* operationName(OperationType type) {
+    switch (type) {
+    case OperationType::AddVolunteer: return "add_volunteer";
+    case OperationType::RemoveVolunteer: return "remove_volunteer";
+    case OperationType::UpdateVolunteer: return "update_volunteer";
+    case OperationType::AddEvent: return "add_event";
+    case OperationType::RemoveEvent: return "remove_event";
+    case OperationType::UpdateEvent: return "update_event";
+    case OperationType::AssignVolunteer: return "assign_volunteer";
+    case OperationType::UnassignVolunteer: return "unassign_volunteer";
+    case OperationType::FilterByDate: return "filter_by_date";
+    case OperationType::FilterByLocation: return "filter_by_location";
+    case OperationType::Undo: return "undo";
+    case OperationType::Redo: return "redo";
+    case OperationType::UpdateEventFields: return "update_event_fields";
+    case OperationType::ImportVolunteers: return "import_volunteers";
+    case OperationType::ImportEvents: return "import_events";
+    }
+    return "unknown";
+}
+
+Event RecordedOperation::event() const {
+    Event result(otherId, text, date, secondText);
+    for (int volunteerId : volunteerIds) {
+        result.addVolunteer(volunteerId);
+    }
+    return result;
+}
+
+RecordedOperation RecordedOperation::forVolunteer(OperationType type, int oldId, const Volunteer& volunteer) {
+    RecordedOperation operation;
+    operation.type = type;
+    operation.id = oldId;
+    operation.otherId = volunteer.getId();
+    operation.text = volunteer.getName();
+    operation.secondText = volunteer.getContactInfo();
+    return operation;
+}
+
+RecordedOperation RecordedOperation::forEvent(OperationType type, int oldId, const Event& event) {
+    RecordedOperation operation;
+    operation.type = type;
+    operation.id = oldId;
+    operation.otherId = event.getId();
+    operation.text = event.getTitle();
+    operation.secondText = event.getLocation();
+    operation.date = event.getDate();
+    operation.volunteerIds = event.getVolunteerIds();
+    return operation;
+}
+
+RecordedOperation RecordedOperation::forEventFields(int id, EventFields fields, const EventFieldValues& values) {
+    RecordedOperation operation;
+    operation.type = OperationType::UpdateEventFields;
+    operation.id = id;
+    operation.otherId = static_cast<int>(fields.toInt());
+    operation.text = values.title;
+    operation.secondText = values.location;
+    operation.date = values.date;
+    operation.volunteerIds = values.volunteerIds;
+    return operation;
+}
+
+RecordedOperation RecordedOperation::forImport(int importIds, const std::vector<Volunteer>& volunteers) {
+    RecordedOperation operation;
+    operation.type = OperationType::ImportVolunteers;
+    operation.id = importIds;
+    operation.importedVolunteers = volunteers;
+    return operation;
+}
+
+RecordedOperation RecordedOperation::forImport(int importIds, const std::vector<Event>& events) {
+    RecordedOperation operation;
+    operation.type = OperationType::ImportEvents;
+    operation.id = importIds;
+    operation.importedEvents = events;
+    return operation;
+}
+
+OperationRecorder::~OperationRecorder() {
+    close();
+}
+
+bool OperationRecorder::open(const QString& filename) {
+    close();
+    m_file.setFileName(filename);
+    if (!m_file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qWarning() << "Could not open operation log for writing:" << filename;
+        return false;
+    }
+    m_out.setDevice(&m_file);
+    m_out.setVersion(QDataStream::Qt_6_0);
+    m_out << kMagic << kVersion;
+    m_count = 0;
+    m_clock.start();
+    return true;
+}
+
+void OperationRecorder::record(RecordedOperation operation) {
+    if (!m_file.isOpen()) {
+        return;
+    }
+    operation.offsetNs = m_clock.nsecsElapsed();
+    m_out << static_cast<quint8>(operation.type) << operation.offsetNs;
+    switch (operation.type) {
+    case OperationType::AddVolunteer:
+    case OperationType::UpdateVolunteer:
+    case OperationType::AddEvent:
+    case OperationType::UpdateEvent:
+    case OperationType::UpdateEventFields:
+        m_out << qint32(operation.id) << qint32(operation.otherId);
+        writeString(m_out, operation.text);
+        writeString(m_out, operation.secondText);
+        if (carriesEvent(operation.type)) {
+            m_out << qint64(operation.date.toJulianDay()) << operation.volunteerIds;
+        }
+        break;
+    case OperationType::RemoveVolunteer:
+    case OperationType::RemoveEvent:
+        m_out << qint32(operation.id);
+        break;
+    case OperationType::AssignVolunteer:
+    case OperationType::UnassignVolunteer:
+        m_out << qint32(operation.id) << qint32(operation.otherId);
+        break;
+    case OperationType::FilterByDate:
+    case OperationType::FilterByLocation:
+        writeString(m_out, operation.text);
+        break;
+    case OperationType::Undo:
+    case OperationType::Redo:
+        break;
+    case OperationType::ImportVolunteers:
+        m_out << qint32(operation.id) << quint32(operation.importedVolunteers.size());
+        for (const Volunteer& volunteer : operation.importedVolunteers) {
+            m_out << qint32(volunteer.getId());
+            writeString(m_out, volunteer.getName());
+            writeString(m_out, volunteer.getContactInfo());
+        }
+        break;
+    case OperationType::ImportEvents:
+        m_out << qint32(operation.id) << quint32(operation.importedEvents.size());
+        for (const Event& event : operation.importedEvents) {
+            writeEvent(m_out, event);
+        }
+        break;
+    }
+    ++m_count;
+}
+
+void OperationRecorder::close() {
+    if (m_file.isOpen()) {
+        m_out.setDevice(nullptr);
+        m_file.close();
+        qDebug() << "Recorded" << m_count << "operations to" << m_file.fileName();
+    }
+}
+
+bool OperationLog::read(const QString& filename, std::vector<RecordedOperation>& operations) {
+    QFile file(filename);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qWarning() << "Could not open operation log for reading:" << filename;
+        return false;
+    }
+    QDataStream in(&file);
+    in.setVersion(QDataStream::Qt_6_0);
+    quint32 magic = 0;
+    quint16 version = 0;
+    in >> magic >> version;
+    if (magic != kMagic || version != kVersion) {
+        qWarning() << "Not an operation log (or unsupported version):" << filename;
+        return false;
+    }
+
+    while (!in.atEnd()) {
+        RecordedOperation operation;
+        quint8 type = 0;
+        in >> type >> operation.offsetNs;
+        if (type >= kOperationTypeCount) {
+            qWarning() << "Unknown operation" << type << "in" << filename;
+            return false;
+        }
+        operation.type = static_cast<OperationType>(type);
+        qint32 id = 0;
+        qint32 otherId = 0;
+        switch (operation.type) {
+        case OperationType::AddVolunteer:
+        case OperationType::UpdateVolunteer:
+        case OperationType::AddEvent:
+        case OperationType::UpdateEvent:
+        case OperationType::UpdateEventFields:
+            in >> id >> otherId;
+            operation.text = readString(in);
+            operation.secondText = readString(in);
+            if (carriesEvent(operation.type)) {
+                qint64 julianDay = 0;
+                in >> julianDay >> operation.volunteerIds;
+                operation.date = QDate::fromJulianDay(julianDay);
+            }
+            break;
+        case OperationType::RemoveVolunteer:
+        case OperationType::RemoveEvent:
+            in >> id;
+            break;
+        case OperationType::AssignVolunteer:
+        case OperationType::UnassignVolunteer:
+            in >> id >> otherId;
+            break;
+        case OperationType::FilterByDate:
+        case OperationType::FilterByLocation:
+            operation.text = readString(in);
+            break;
+        case OperationType::Undo:
+        case OperationType::Redo:
+            break;
+        case OperationType::ImportVolunteers:
+        case OperationType::ImportEvents: {
+            quint32 rows = 0;
+            in >> id >> rows;
+            for (quint32 row = 0; row < rows && in.status() == QDataStream::Ok; ++row) {
+                if (operation.type == OperationType::ImportVolunteers) {
+                    qint32 volunteerId = 0;
+                    in >> volunteerId;
+                    const QString name = readString(in);
+                    operation.importedVolunteers.emplace_back(volunteerId, name, readString(in));
+                } else {
+                    operation.importedEvents.push_back(readEvent(in));
+                }
+            }
+            break;
+        }
+        }
+        if (in.status() != QDataStream::Ok) {
+            qWarning() << "Truncated operation log:" << filename << "after" << operations.size() << "operations";
+            return false;
+        }
+        operation.id = id;
+        operation.otherId = otherId;
+        operations.push_back(operation);
+    }
+    return true;
+}
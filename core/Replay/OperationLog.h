@@ -0,0 +1,89 @@
+#ifndef OPERATIONLOG_H
+#define OPERATIONLOG_H
+
+#include "../../Model/Volunteer.h"
+#include "../../Model/Event.h"
+#include "../../Model/EventFields.h"
+#include <QDataStream>
+#include <QDate>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QList>
+#include <QString>
+#include <vector>
+
+enum class OperationType : quint8 {
+    AddVolunteer,
+    RemoveVolunteer,
+    UpdateVolunteer,
+    AddEvent,
+    RemoveEvent,
+    UpdateEvent,
+    AssignVolunteer,
+    UnassignVolunteer,
+    FilterByDate,
+    FilterByLocation,
+    Undo,
+    Redo,
+    UpdateEventFields, // Appended so existing logs keep their type numbers
+    ImportVolunteers,
+    ImportEvents
+};
+
+constexpr int kOperationTypeCount = static_cast<int>(OperationType::ImportEvents) + 1;
+
+const char* operationName(OperationType type);
+
+// One Controller call with its arguments. Only the fields the call takes are meaningful.
+struct RecordedOperation {
+    OperationType type = OperationType::Undo;
+    qint64 offsetNs = 0;        // Since recording started
+    int id = 0;                 // Volunteer or event ID; the old ID for updates; the volunteer for assignments;
+                                // the ImportIds mode for imports
+    int otherId = 0;            // The event for assignments; the EventFields mask for partial updates
+    QString text;               // Name, title or filter text
+    QString secondText;         // Contact info or location
+    QDate date;
+    QList<int> volunteerIds;    // Event updates carry the full assignment list
+    std::vector<Volunteer> importedVolunteers; // Every input row of an import, before validation
+    std::vector<Event> importedEvents;
+
+    Volunteer volunteer() const { return Volunteer(otherId, text, secondText); }
+    Event event() const;
+
+    static RecordedOperation forVolunteer(OperationType type, int oldId, const Volunteer& volunteer);
+    static RecordedOperation forEvent(OperationType type, int oldId, const Event& event);
+    static RecordedOperation forEventFields(int id, EventFields fields, const EventFieldValues& values);
+    static RecordedOperation forImport(int importIds, const std::vector<Volunteer>& volunteers);
+    static RecordedOperation forImport(int importIds, const std::vector<Event>& events);
+    EventFieldValues eventFieldValues() const { return {text, date, secondText, volunteerIds}; }
+};
+
+// Appends operations to a compact binary log: a header, then one variable-length record per
+// call with strings as UTF-8 and only the fields that call uses. Writes go through QFile's buffer.
+class OperationRecorder {
+public:
+    OperationRecorder() = default;
+    ~OperationRecorder();
+
+    bool open(const QString& filename);
+    void record(RecordedOperation operation);
+    void close();
+
+    bool isOpen() const { return m_file.isOpen(); }
+    qint64 recordedCount() const { return m_count; }
+
+private:
+    QFile m_file;
+    QDataStream m_out;
+    QElapsedTimer m_clock;
+    qint64 m_count = 0;
+};
+
+class OperationLog {
+public:
+    // Reads a whole log; false (with a warning) if the file is missing, not a log, or truncated
+    static bool read(const QString& filename, std::vector<RecordedOperation>& operations);
+};
+
+#endif // OPERATIONLOG_H
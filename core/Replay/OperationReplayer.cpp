@@ -0,0 +1,100 @@
+#include "OperationReplayer.h"
+#include "../../Controller/Controller.h"
+#include <QElapsedTimer>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+QByteArray ReplayReport::toJson() const {
+    QJsonObject perOperation;
+    for (int i = 0; i < kOperationTypeCount; ++i) {
+        const HistogramSnapshot& h = latency[static_cast<std::size_t>(i)];
+        if (h.count == 0) {
+            continue;
+        }
+        QJsonObject entry;
+        entry.insert("count", static_cast<qint64>(h.count));
+        entry.insert("mean_ns", h.meanNs());
+        entry.insert("p50_ns", static_cast<qint64>(h.p50Ns));
+        entry.insert("p99_ns", static_cast<qint64>(h.p99Ns));
+        entry.insert("max_ns", static_cast<qint64>(h.maxNs));
+        perOperation.insert(operationName(static_cast<OperationType>(i)), entry);
+    }
+    QJsonObject root;
+    root.insert("operations", operations);
+    root.insert("elapsed_ns", elapsedNs);
+    root.insert("operations_per_second", operationsPerSecond());
+    root.insert("latency", perOperation);
+    return QJsonDocument(root).toJson(QJsonDocument::Indented);
+}
+
+static void apply(Controller& controller, const RecordedOperation& operation) {
+    switch (operation.type) {
+    case OperationType::AddVolunteer:
+        controller.addVolunteer(operation.volunteer());
+        break;
+    case OperationType::RemoveVolunteer:
+        controller.removeVolunteer(operation.id);
+        break;
+    case OperationType::UpdateVolunteer:
+        controller.updateVolunteer(operation.id, operation.volunteer());
+        break;
+    case OperationType::AddEvent:
+        controller.addEvent(operation.event());
+        break;
+    case OperationType::RemoveEvent:
+        controller.removeEvent(operation.id);
+        break;
+    case OperationType::UpdateEvent:
+        controller.updateEvent(operation.id, operation.event());
+        break;
+    case OperationType::AssignVolunteer:
+        controller.addVolunteerToEvent(operation.id, operation.otherId);
+        break;
+    case OperationType::UnassignVolunteer:
+        controller.removeVolunteerFromEvent(operation.id, operation.otherId);
+        break;
+    case OperationType::FilterByDate:
+        controller.filterEventsByDate(operation.text);
+        break;
+    case OperationType::FilterByLocation:
+        controller.filterEventsByLocation(operation.text);
+        break;
+    case OperationType::Undo:
+        controller.undo();
+        break;
+    case OperationType::Redo:
+        controller.redo();
+        break;
+    case OperationType::UpdateEventFields:
+        controller.updateEventFields(operation.id, EventFields::fromInt(static_cast<quint32>(operation.otherId)),
+                                     operation.eventFieldValues());
+        break;
+    case OperationType::ImportVolunteers:
+        controller.importVolunteers(operation.importedVolunteers, static_cast<ImportIds>(operation.id));
+        break;
+    case OperationType::ImportEvents:
+        controller.importEvents(operation.importedEvents, static_cast<ImportIds>(operation.id));
+        break;
+    }
+}
+
+ReplayReport OperationReplayer::replay(Controller& controller, const std::vector<RecordedOperation>& operations) {
+    // Histograms are local so a replay does not mix with the process-wide metrics
+    auto histograms = std::make_unique<std::array<LatencyHistogram, kOperationTypeCount>>();
+    QElapsedTimer total;
+    QElapsedTimer single;
+    total.start();
+    for (const RecordedOperation& operation : operations) {
+        single.start();
+        apply(controller, operation);
+        (*histograms)[static_cast<std::size_t>(operation.type)].record(static_cast<quint64>(single.nsecsElapsed()));
+    }
+
+    ReplayReport report;
+    report.elapsedNs = total.nsecsElapsed();
+    report.operations = static_cast<qint64>(operations.size());
+    for (int i = 0; i < kOperationTypeCount; ++i) {
+        report.latency[static_cast<std::size_t>(i)] = (*histograms)[static_cast<std::size_t>(i)].snapshot();
+    }
+    return report;
+}
@@ -0,0 +1,29 @@
+#ifndef OPERATIONREPLAYER_H
+#define OPERATIONREPLAYER_H
+
+#include "OperationLog.h"
+#include "../Metrics/Metrics.h"
+#include <array>
+#include <memory>
+
+class Controller;
+
+struct ReplayReport {
+    qint64 operations = 0;
+    qint64 elapsedNs = 0;
+    std::array<HistogramSnapshot, kOperationTypeCount> latency; // Indexed by OperationType
+
+    double operationsPerSecond() const {
+        return elapsedNs > 0 ? static_cast<double>(operations) * 1e9 / static_cast<double>(elapsedNs) : 0.0;
+    }
+    QByteArray toJson() const;
+};
+
+// Issues recorded operations against a controller back to back, ignoring the recorded
+// timing, and measures each call. The controller's repositories decide which backend is exercised.
+class OperationReplayer {
+public:
+    static ReplayReport replay(Controller& controller, const std::vector<RecordedOperation>& operations);
+};
+
+#endif // OPERATIONREPLAYER_H
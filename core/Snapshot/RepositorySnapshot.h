@@ -0,0 +1,240 @@
+#ifndef REPOSITORYSNAPSHOT_H
+#define REPOSITORYSNAPSHOT_H
+
+#include "../../Repository/BaseRepository.h"
+#include "../../Repository/RepositoryObserver.h"
+#include "../Metrics/MemoryUsage.h"
+#include <QHash>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// One immutable version of a repository's contents, in storage order. Items live in ref-counted chunks
+// shared with older and newer versions, so a snapshot costs one pointer per chunk rather than a copy of
+// the data. Every member may be called from any thread for as long as the snapshot is held.
+template <typename T>
+class RepositorySnapshot {
+public:
+    using Chunk = std::vector<T>;
+
+    RepositorySnapshot(std::vector<std::shared_ptr<const Chunk>> chunks, std::uint64_t generation)
+        : m_chunks(std::move(chunks)), m_generation(generation) {
+        m_ends.reserve(m_chunks.size());
+        std::size_t end = 0;
+        for (const auto& chunk : m_chunks) {
+            end += chunk->size();
+            m_ends.push_back(end);
+        }
+    }
+
+    // The repository generation this version was taken at
+    std::uint64_t generation() const {
+        return m_generation;
+    }
+
+    std::size_t count() const {
+        return m_ends.empty() ? 0 : m_ends.back();
+    }
+
+    // O(log chunks)
+    const T& at(std::size_t position) const {
+        const auto end = std::upper_bound(m_ends.begin(), m_ends.end(), position);
+        const std::size_t chunk = static_cast<std::size_t>(end - m_ends.begin());
+        const std::size_t begin = chunk == 0 ? 0 : m_ends[chunk - 1];
+        return (*m_chunks[chunk])[position - begin];
+    }
+
+    // The item with this ID, or nullptr. The ID index is built by the first caller, once per snapshot.
+    const T* findById(int id) const {
+        std::call_once(m_indexOnce, [this]() {
+            m_index.reserve(static_cast<qsizetype>(count()));
+            forEach([this](const T& item) { m_index.insert(item.getId(), &item); });
+        });
+        return m_index.value(id, nullptr);
+    }
+
+    // The items in chunkCount() contiguous runs, for scans that poll for cancellation between runs
+    std::size_t chunkCount() const {
+        return m_chunks.size();
+    }
+
+    const Chunk& chunk(std::size_t index) const {
+        return *m_chunks[index];
+    }
+
+    void forEach(const std::function<void(const T&)>& visitor) const {
+        for (const auto& chunk : m_chunks) {
+            for (const T& item : *chunk) {
+                visitor(item);
+            }
+        }
+    }
+
+    // Heap held by this version itself, excluding the shared chunks and the lazily built ID index
+    std::size_t memoryBytes() const {
+        return vectorHeapBytes(m_chunks) + vectorHeapBytes(m_ends);
+    }
+
+    std::vector<T> toVector() const {
+        std::vector<T> items;
+        items.reserve(count());
+        forEach([&items](const T& item) { items.push_back(item); });
+        return items;
+    }
+
+private:
+    std::vector<std::shared_ptr<const Chunk>> m_chunks;
+    std::vector<std::size_t> m_ends; // Running item count at the end of each chunk
+    std::uint64_t m_generation;
+    mutable std::once_flag m_indexOnce;
+    mutable QHash<int, const T*> m_index;
+};
+
+// Mirrors a repository as chunks of at most chunkSize items, kept current through repository
+// notifications on the writer's thread. A chunk still referenced by a published snapshot is copied
+// before it is changed (copy-on-write), so a write costs one chunk copy at most and published
+// versions are never touched again. Writer-side only; readers hold the RepositorySnapshot it returns.
+template <typename T>
+class SnapshotStore : public RepositoryObserver<T> {
+public:
+    using Chunk = std::vector<T>;
+    static constexpr std::size_t chunkSize = 512;
+
+    void rebuild(const BaseRepository<T>& repository) {
+        m_chunks.clear();
+        m_chunkOf.clear();
+        m_count = 0;
+        repository.forEach([this](const T& item) { append(item); });
+        m_published.reset();
+        m_dirty = true;
+    }
+
+    // Estimated heap held by the chunks, the ID map and the published version's bookkeeping. Item
+    // strings share their buffers with the repository and are not counted again, nor are chunks kept
+    // alive only by older versions readers still hold.
+    std::size_t memoryBytes() const {
+        std::size_t bytes = vectorHeapBytes(m_chunks) + hashHeapBytes(m_chunkOf);
+        for (const auto& chunk : m_chunks) {
+            bytes += sizeof(Chunk) + vectorHeapBytes(*chunk);
+        }
+        if (m_published) {
+            bytes += sizeof(RepositorySnapshot<T>) + m_published->memoryBytes();
+        }
+        return bytes;
+    }
+
+    // True once a change has been mirrored that the last snapshot() does not include
+    bool isDirty() const {
+        return m_dirty;
+    }
+
+    // The current version; a new one is assembled only when something changed since the last call
+    std::shared_ptr<const RepositorySnapshot<T>> snapshot(std::uint64_t generation) {
+        if (m_published && !m_dirty) {
+            return m_published;
+        }
+        repackIfSparse();
+        std::vector<std::shared_ptr<const Chunk>> chunks;
+        chunks.reserve(m_chunks.size());
+        for (const auto& chunk : m_chunks) {
+            if (!chunk->empty()) {
+                chunks.push_back(chunk);
+            }
+        }
+        m_published = std::make_shared<const RepositorySnapshot<T>>(std::move(chunks), generation);
+        m_dirty = false;
+        return m_published;
+    }
+
+    void onAdded(const T& item) override {
+        append(item);
+        m_dirty = true;
+    }
+
+    void onRemoved(const T& item) override {
+        auto slot = m_chunkOf.constFind(item.getId());
+        if (slot == m_chunkOf.constEnd()) {
+            return;
+        }
+        Chunk& chunk = writable(slot.value());
+        chunk.erase(std::find_if(chunk.begin(), chunk.end(), [&item](const T& stored) {
+            return stored.getId() == item.getId();
+        }));
+        m_chunkOf.erase(slot);
+        --m_count;
+        m_dirty = true;
+    }
+
+    void onUpdated(const T& oldItem, const T& newItem) override {
+        auto slot = m_chunkOf.constFind(oldItem.getId());
+        if (slot == m_chunkOf.constEnd()) {
+            return;
+        }
+        const std::size_t index = slot.value();
+        Chunk& chunk = writable(index);
+        *std::find_if(chunk.begin(), chunk.end(), [&oldItem](const T& stored) {
+            return stored.getId() == oldItem.getId();
+        }) = newItem;
+        if (newItem.getId() != oldItem.getId()) {
+            m_chunkOf.erase(slot);
+            m_chunkOf.insert(newItem.getId(), index);
+        }
+        m_dirty = true;
+    }
+
+private:
+    void append(const T& item) {
+        if (m_chunks.empty() || m_chunks.back()->size() >= chunkSize) {
+            m_chunks.push_back(std::make_shared<Chunk>());
+            m_chunks.back()->reserve(chunkSize);
+        }
+        const std::size_t index = m_chunks.size() - 1;
+        writable(index).push_back(item);
+        m_chunkOf.insert(item.getId(), index);
+        ++m_count;
+    }
+
+    // Only the writer adds references to a chunk, so a count of one cannot be stale: no snapshot holds it.
+    // The fence orders the last reader's release of the chunk before the writes that follow.
+    Chunk& writable(std::size_t index) {
+        auto& chunk = m_chunks[index];
+        if (chunk.use_count() == 1) {
+            std::atomic_thread_fence(std::memory_order_acquire);
+        } else {
+            auto copy = std::make_shared<Chunk>();
+            copy->reserve(chunkSize);
+            copy->assign(chunk->begin(), chunk->end());
+            chunk = std::move(copy);
+        }
+        return *chunk;
+    }
+
+    // Removals leave chunks partly empty; once they average under a quarter full, the items are
+    // packed into fresh chunks so a snapshot stays proportional to the data
+    void repackIfSparse() {
+        if (m_chunks.size() <= 1 || m_count * 4 >= m_chunks.size() * chunkSize) {
+            return;
+        }
+        std::vector<std::shared_ptr<Chunk>> chunks;
+        chunks.swap(m_chunks);
+        m_chunkOf.clear();
+        m_count = 0;
+        for (const auto& chunk : chunks) {
+            for (const T& item : *chunk) {
+                append(item);
+            }
+        }
+    }
+
+    std::vector<std::shared_ptr<Chunk>> m_chunks;
+    QHash<int, std::size_t> m_chunkOf; // ID -> index in m_chunks
+    std::size_t m_count = 0;
+    std::shared_ptr<const RepositorySnapshot<T>> m_published;
+    bool m_dirty = true;
+};
+
+#endif // REPOSITORYSNAPSHOT_H
@@ -0,0 +1,173 @@
+#include "Trace.h"
+#include <QCoreApplication>
+#include <QDebug>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSaveFile>
+#include <QThread>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace {
+
+struct TraceRecord {
+    const char* category;
+    const char* name;
+    qint64 startNs;
+    qint64 durationNs;
+};
+
+// Bounds memory when tracing is left on: ~32 MB per thread
+constexpr std::size_t kMaxSpansPerThread = 1 << 20;
+
+struct ThreadBuffer {
+    QMutex mutex; // Only contended while an export or clear reads this buffer
+    std::vector<TraceRecord> spans;
+    std::size_t dropped = 0;
+    quint64 threadId = 0;
+    QString threadName;
+};
+
+// Buffers outlive their threads so spans from finished workers still export
+struct BufferRegistry {
+    QMutex mutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+};
+
+BufferRegistry& registry() {
+    static BufferRegistry instance;
+    return instance;
+}
+
+ThreadBuffer& localBuffer() {
+    thread_local std::shared_ptr<ThreadBuffer> buffer = []() {
+        auto created = std::make_shared<ThreadBuffer>();
+        created->threadId = reinterpret_cast<quintptr>(QThread::currentThreadId());
+        created->threadName = QThread::currentThread()->objectName();
+        if (created->threadName.isEmpty() && QCoreApplication::instance()
+            && QThread::currentThread() == QCoreApplication::instance()->thread()) {
+            created->threadName = "main";
+        }
+        BufferRegistry& all = registry();
+        QMutexLocker locker(&all.mutex);
+        all.buffers.push_back(created);
+        return created;
+    }();
+    return *buffer;
+}
+
+void appendEscaped(QByteArray& out, QByteArrayView text) {
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+        }
+        out += c >= 0 && c < 0x20 ? ' ' : c;
+    }
+}
+
+} // namespace
+
+std::atomic<bool> Tracer::s_enabled{false};
+
+void Tracer::setEnabled(bool enabled) {
+    s_enabled.store(enabled, std::memory_order_relaxed);
+    qDebug() << "Tracing" << (enabled ? "enabled." : "disabled.");
+}
+
+qint64 Tracer::nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void Tracer::record(const char* category, const char* name, qint64 startNs, qint64 endNs) {
+    ThreadBuffer& buffer = localBuffer();
+    QMutexLocker locker(&buffer.mutex);
+    if (buffer.spans.size() >= kMaxSpansPerThread) {
+        ++buffer.dropped;
+        return;
+    }
+    buffer.spans.push_back({category, name, startNs, endNs - startNs});
+}
+
+void Tracer::clear() {
+    BufferRegistry& all = registry();
+    QMutexLocker locker(&all.mutex);
+    for (const auto& buffer : all.buffers) {
+        QMutexLocker bufferLocker(&buffer->mutex);
+        buffer->spans.clear();
+        buffer->dropped = 0;
+    }
+}
+
+std::size_t Tracer::spanCount() {
+    BufferRegistry& all = registry();
+    QMutexLocker locker(&all.mutex);
+    std::size_t total = 0;
+    for (const auto& buffer : all.buffers) {
+        QMutexLocker bufferLocker(&buffer->mutex);
+        total += buffer->spans.size();
+    }
+    return total;
+}
+
+std::size_t Tracer::droppedCount() {
+    BufferRegistry& all = registry();
+    QMutexLocker locker(&all.mutex);
+    std::size_t total = 0;
+    for (const auto& buffer : all.buffers) {
+        QMutexLocker bufferLocker(&buffer->mutex);
+        total += buffer->dropped;
+    }
+    return total;
+}
+
+bool Tracer::exportChromeTrace(const QString& filename) {
+    QSaveFile file(filename);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "Could not open trace file for writing:" << filename;
+        return false;
+    }
+
+    const QByteArray pid = QByteArray::number(QCoreApplication::applicationPid());
+    QByteArray out = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    std::size_t exported = 0;
+    BufferRegistry& all = registry();
+    QMutexLocker locker(&all.mutex);
+    for (const auto& buffer : all.buffers) {
+        QMutexLocker bufferLocker(&buffer->mutex);
+        const QByteArray tid = QByteArray::number(buffer->threadId);
+        if (!buffer->threadName.isEmpty()) {
+            out += first ? "\n" : ",\n";
+            first = false;
+            out += "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":" + pid + ",\"tid\":" + tid + ",\"args\":{\"name\":\"";
+            appendEscaped(out, buffer->threadName.toUtf8());
+            out += "\"}}";
+        }
+        // Complete ("X") events; timestamps in microseconds
+        for (const TraceRecord& span : buffer->spans) {
+            out += first ? "\n" : ",\n";
+            first = false;
+            out += "{\"ph\":\"X\",\"cat\":\"";
+            appendEscaped(out, span.category);
+            out += "\",\"name\":\"";
+            appendEscaped(out, span.name);
+            out += "\",\"ts\":" + QByteArray::number(static_cast<double>(span.startNs) / 1000.0, 'f', 3)
+                 + ",\"dur\":" + QByteArray::number(static_cast<double>(span.durationNs) / 1000.0, 'f', 3)
+                 + ",\"pid\":" + pid + ",\"tid\":" + tid + "}";
+            if (out.size() > (1 << 20)) {
+                file.write(out);
+                out.clear();
+            }
+        }
+        exported += buffer->spans.size();
+    }
+    out += "\n]}\n";
+    file.write(out);
+    if (!file.commit()) {
+        qWarning() << "Could not write trace file:" << filename;
+        return false;
+    }
+    qDebug() << "Exported" << exported << "spans to" << filename;
+    return true;
+}
@@ -0,0 +1,60 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <QString>
+#include <atomic>
+#include <cstddef>
+
+// Scoped timing spans exported in Chrome trace format (chrome://tracing, ui.perfetto.dev).
+// Each thread appends completed spans to its own buffer, so recording never contends with
+// other threads. While tracing is off a span costs one relaxed atomic load.
+class Tracer {
+public:
+    static void setEnabled(bool enabled);
+    static bool isEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+    // Writes every buffered span as Chrome trace JSON; the buffers are left intact
+    static bool exportChromeTrace(const QString& filename);
+    static void clear();
+    // Spans buffered across all threads, and spans dropped because a thread's buffer was full
+    static std::size_t spanCount();
+    static std::size_t droppedCount();
+
+    // Used by TraceSpan; names and categories must be string literals (they are stored unowned)
+    static qint64 nowNs();
+    static void record(const char* category, const char* name, qint64 startNs, qint64 endNs);
+
+private:
+    static std::atomic<bool> s_enabled;
+};
+
+class TraceSpan {
+public:
+    TraceSpan(const char* category, const char* name)
+        : m_category(category), m_name(name), m_startNs(Tracer::isEnabled() ? Tracer::nowNs() : -1) {}
+    ~TraceSpan() {
+        if (m_startNs >= 0) {
+            Tracer::record(m_category, m_name, m_startNs, Tracer::nowNs());
+        }
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+private:
+    const char* m_category;
+    const char* m_name;
+    qint64 m_startNs;
+};
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+
+// Spans the rest of the enclosing scope. Building with VOLUNTEER_DISABLE_TRACING removes it entirely.
+#ifdef VOLUNTEER_DISABLE_TRACING
+#define TRACE_SCOPE(category, name) do { } while (false)
+#else
+#define TRACE_SCOPE(category, name) TraceSpan TRACE_CONCAT(traceSpan_, __LINE__)(category, name)
+#endif
+
+#endif // TRACE_H
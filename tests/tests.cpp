@@ -3,6 +3,8 @@
 #include <QTemporaryDir>
 #include <QDate>
 #include <QDebug>
+#include <QBuffer>
+#include <QtConcurrent/QtConcurrent>
 #include <memory>
 #include <algorithm>
 
@@ -12,6 +14,11 @@
 #include "../Repository/CSV/CSVVolunteerRepository.h"
 #include "../Repository/CSV/CSVEventRepository.h"
 #include "../Controller/Controller.h"
+#include "../Controller/AsyncController.h"
+#include "../core/Trace/Trace.h"
+#include "../core/Replay/OperationReplayer.h"
+#include "../Repository/JSON/JSONVolunteerRepository.h"
+#include "../Repository/JSON/JSONEventRepository.h"
 
 class TestVolunteerManagement : public QObject
 {
@@ -56,6 +63,32 @@ private slots:
     void testControllerUndoRedo();
     void testControllerFilterEventsByDate(); // NEW
     void testControllerFilterEventsByLocation(); // NEW
+    void testControllerImportVolunteers();
+    void testControllerImportEvents();
+    void testControllerExportEventReport();
+    void testControllerQueryEvents();
+    void testControllerQueryVolunteers();
+    void testControllerUpcomingEvents();
+    void testControllerAggregates();
+    void testControllerDoubleBooking();
+    void testControllerAssignedIds();
+    void testControllerChangeNotifications();
+    void testControllerRowAccess();
+    void testFilterEventIdsCancellation();
+    void testControllerFindById();
+    void testControllerMetrics();
+    void testTraceExport();
+    void testControllerMemoryUsage();
+    void testOperationRecordReplay();
+    void testFileRepositorySchemaCodec();
+    void testMoveAndEmplaceMutations();
+    void testControllerUpdateEventFields();
+    void testControllerQueryCache();
+    void testControllerSnapshotReads();
+    void testAsyncControllerOrdering();
+    void testRemovedVolunteerIdNotInherited();
+    void testDoubleBookingOnDateChangeAndImport();
+    void testControllerShutdownWithMetricsDump();
 
     // Integration tests
     void testCompleteWorkflow();
@@ -102,6 +135,8 @@ void TestVolunteerManagement::cleanup()
     // Clean up test files
     QFile::remove(m_volunteerCsvPath);
     QFile::remove(m_eventCsvPath);
+    QFile::remove(m_volunteerCsvPath + ".ids");
+    QFile::remove(m_eventCsvPath + ".ids");
     m_controller.reset();
 }
 
@@ -690,6 +725,1092 @@ void TestVolunteerManagement::testControllerFilterEventsByLocation()
     QCOMPARE(filteredEvents.size(), 4);
 }
 
+void TestVolunteerManagement::testControllerImportVolunteers()
+{
+    auto volunteerRepo = std::make_unique<CSVVolunteerRepository>(m_volunteerCsvPath);
+    auto eventRepo = std::make_unique<CSVEventRepository>(m_eventCsvPath);
+    m_controller = std::make_unique<Controller>(std::move(volunteerRepo), std::move(eventRepo));
+
+    m_controller->addVolunteer(Volunteer(1, "Alice", "alice@example.com"));
+
+    std::vector<Volunteer> batch;
+    for (int id = 2; id <= 1001; ++id) {
+        batch.emplace_back(id, QString("Volunteer %1").arg(id), QString("v%1@example.com").arg(id));
+    }
+    batch.emplace_back(1, "Existing", "existing@example.com");    // clashes with the repository
+    batch.emplace_back(2, "Duplicate", "duplicate@example.com");  // clashes inside the import
+    batch.emplace_back(5000, "", "empty@example.com");            // malformed name
+    batch.emplace_back(5001, "Comma, Name", "comma@example.com"); // would break the CSV layout
+
+    ImportResult result = m_controller->importVolunteers(batch);
+    QCOMPARE(result.imported, 1000);
+    QCOMPARE(result.issues.size(), 4);
+    QCOMPARE(m_controller->getAllVolunteers().size(), 1001);
+
+    // The import is recorded as a single undoable command
+    m_controller->undo();
+    QCOMPARE(m_controller->getAllVolunteers().size(), 1);
+    m_controller->redo();
+    QCOMPARE(m_controller->getAllVolunteers().size(), 1001);
+
+    // Importing from a file goes through the same validation
+    QString importPath = m_tempDir + "/import_volunteers.csv";
+    QFile file(importPath);
+    QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Text));
+    file.write("2000,Dana,dana@example.com\nnot a volunteer line\n2001,Eli,eli@example.com\n");
+    file.close();
+
+    result = m_controller->importVolunteers(importPath);
+    QCOMPARE(result.imported, 2);
+    QCOMPARE(result.issues.size(), 1);
+    QCOMPARE(result.issues[0].id, -1);
+    QCOMPARE(m_controller->getAllVolunteers().size(), 1003);
+    QFile::remove(importPath);
+}
+
+void TestVolunteerManagement::testControllerImportEvents()
+{
+    auto volunteerRepo = std::make_unique<CSVVolunteerRepository>(m_volunteerCsvPath);
+    auto eventRepo = std::make_unique<CSVEventRepository>(m_eventCsvPath);
+    m_controller = std::make_unique<Controller>(std::move(volunteerRepo), std::move(eventRepo));
+
+    m_controller->addVolunteer(Volunteer(1, "Alice", "alice@example.com"));
+    m_controller->addVolunteer(Volunteer(2, "Bob", "bob@example.com"));
+
+    QDate date(2024, 6, 15);
+    Event staffed(100, "Community Cleanup", date, "Central Park");
+    staffed.addVolunteer(1);
+    staffed.addVolunteer(2);
+    Event unknownVolunteer(101, "Food Drive", date, "Community Center");
+    unknownVolunteer.addVolunteer(42);
+    Event invalidDate(102, "Book Reading", QDate(), "Public Library");
+
+    ImportResult result = m_controller->importEvents({staffed, unknownVolunteer, invalidDate});
+    QCOMPARE(result.imported, 1);
+    QCOMPARE(result.issues.size(), 2);
+
+    std::vector<Event> events = m_controller->getAllEvents();
+    QCOMPARE(events.size(), 1);
+    QCOMPARE(events[0].getId(), 100);
+    QCOMPARE(events[0].getVolunteerIds().size(), 2);
+
+    m_controller->undo();
+    QVERIFY(m_controller->getAllEvents().empty());
+}
+
+void TestVolunteerManagement::testControllerExportEventReport()
+{
+    auto volunteerRepo = std::make_unique<CSVVolunteerRepository>(m_volunteerCsvPath);
+    auto eventRepo = std::make_unique<CSVEventRepository>(m_eventCsvPath);
+    m_controller = std::make_unique<Controller>(std::move(volunteerRepo), std::move(eventRepo));
+
+    m_controller->addVolunteer(Volunteer(1, "Alice", "alice@example.com"));
+    m_controller->addVolunteer(Volunteer(2, "Bob \"The Builder\"", "bob@example.com"));
+
+    std::vector<Event> events;
+    for (int id = 1; id <= 50; ++id) {
+        Event event(id, QString("Event %1").arg(id), QDate(2024, 1, 1).addDays(id), "Town Hall");
+        if (id % 2 == 0) {
+            event.addVolunteer(1);
+            event.addVolunteer(2);
+        }
+        events.push_back(event);
+    }
+    QCOMPARE(m_controller->importEvents(events).imported, 50);
+
+    QString csvPath = m_tempDir + "/report.csv";
+    ExportOptions options;
+    options.blockSize = 7;
+    QCOMPARE(m_controller->exportEventReport(csvPath, options), 50);
+
+    QFile csvFile(csvPath);
+    QVERIFY(csvFile.open(QIODevice::ReadOnly | QIODevice::Text));
+    QList<QByteArray> lines = csvFile.readAll().split('\n');
+    csvFile.close();
+    QCOMPARE(lines[0], QByteArray("event_id,title,date,location,volunteer_count,volunteers"));
+    QCOMPARE(lines[2], QByteArray("2,Event 2,2024-01-03,Town Hall,2,\"Alice;Bob \"\"The Builder\"\"\""));
+
+    // Parallel formatting of blocks must produce the same bytes in the same order
+    QString jsonPath = m_tempDir + "/report.jsonl";
+    QString parallelJsonPath = m_tempDir + "/report_parallel.jsonl";
+    options.format = ExportFormat::JsonLines;
+    QCOMPARE(m_controller->exportEventReport(jsonPath, options), 50);
+    options.threads = 4;
+    QCOMPARE(m_controller->exportEventReport(parallelJsonPath, options), 50);
+
+    QFile jsonFile(jsonPath);
+    QFile parallelJsonFile(parallelJsonPath);
+    QVERIFY(jsonFile.open(QIODevice::ReadOnly));
+    QVERIFY(parallelJsonFile.open(QIODevice::ReadOnly));
+    QByteArray json = jsonFile.readAll();
+    QCOMPARE(parallelJsonFile.readAll(), json);
+    QVERIFY(json.startsWith("{\"id\":1,\"title\":\"Event 1\",\"date\":\"2024-01-02\",\"location\":\"Town Hall\",\"volunteers\":[]}\n"));
+    jsonFile.close();
+    parallelJsonFile.close();
+
+    QFile::remove(csvPath);
+    QFile::remove(jsonPath);
+    QFile::remove(parallelJsonPath);
+}
+
+void TestVolunteerManagement::testControllerQueryEvents()
+{
+    auto volunteerRepo = std::make_unique<CSVVolunteerRepository>(m_volunteerCsvPath);
+    auto eventRepo = std::make_unique<CSVEventRepository>(m_eventCsvPath);
+    m_controller = std::make_unique<Controller>(std::move(volunteerRepo), std::move(eventRepo));
+
+    std::vector<Event> events;
+    for (int id = 1; id <= 30; ++id) {
+        // Ids run opposite to titles so a title sort is distinguishable from insertion order
+        events.emplace_back(id, QString("Event %1").arg(31 - id), QDate(2024, 1, 1).addDays(id),
+                            id % 3 == 0 ? "Central Park" : "Town Hall");
+    }
+    QCOMPARE(m_controller->importEvents(events).imported, 30);
+
+    // Numeric collation: "Event 2" sorts before "Event 10"
+    QueryPage<Event> page = m_controller->queryEvents(EventFilter(), EventSortKey::Title, 0, 5);
+    QCOMPARE(page.total, 30);
+    QCOMPARE(page.items.size(), 5);
+    QCOMPARE(page.items[0].getTitle(), QString("Event 1"));
+    QCOMPARE(page.items[1].getTitle(), QString("Event 2"));
+    QCOMPARE(page.items[4].getTitle(), QString("Event 5"));
+
+    page = m_controller->queryEvents(EventFilter(), EventSortKey::Title, 25, 10);
+    QCOMPARE(page.items.size(), 5);
+    QCOMPARE(page.items[0].getTitle(), QString("Event 26"));
+    QCOMPARE(page.items[4].getTitle(), QString("Event 30"));
+
+    EventFilter parkFilter;
+    parkFilter.locationContains = "park";
+    page = m_controller->queryEvents(parkFilter, EventSortKey::Date, 0, 3, SortOrder::Descending);
+    QCOMPARE(page.total, 10);
+    QCOMPARE(page.items.size(), 3);
+    QCOMPARE(page.items[0].getId(), 30);
+    QCOMPARE(page.items[1].getId(), 27);
+    QCOMPARE(page.items[2].getId(), 24);
+
+    // Updates and their undo keep the precomputed sort keys current
+    m_controller->updateEvent(1, Event(1, "Aardvark Meetup", QDate(2024, 1, 2), "Town Hall"));
+    page = m_controller->queryEvents(EventFilter(), EventSortKey::Title, 0, 1);
+    QCOMPARE(page.items[0].getId(), 1);
+    m_controller->undo();
+    page = m_controller->queryEvents(EventFilter(), EventSortKey::Title, 0, 1);
+    QCOMPARE(page.items[0].getId(), 30);
+}
+
+void TestVolunteerManagement::testControllerQueryVolunteers()
+{
+    auto volunteerRepo = std::make_unique<CSVVolunteerRepository>(m_volunteerCsvPath);
+    auto eventRepo = std::make_unique<CSVEventRepository>(m_eventCsvPath);
+    m_controller = std::make_unique<Controller>(std::move(volunteerRepo), std::move(eventRepo));
+
+    m_controller->addVolunteer(Volunteer(1, "charlie", "c@example.com"));
+    m_controller->addVolunteer(Volunteer(2, "Alice", "a@example.org"));
+    m_controller->addVolunteer(Volunteer(3, "bob", "b@example.com"));
+
+    QueryPage<Volunteer> page = m_controller->queryVolunteers(VolunteerFilter(), VolunteerSortKey::Name, 0, -1);
+    QCOMPARE(page.total, 3);
+    QCOMPARE(page.items[0].getName(), QString("Alice"));
+    QCOMPARE(page.items[1].getName(), QString("bob"));
+    QCOMPARE(page.items[2].getName(), QString("charlie"));
+
+    VolunteerFilter filter;
+    filter.contactContains = ".com";
+    page = m_controller->queryVolunteers(filter, VolunteerSortKey::Id, 0, 10, SortOrder::Descending);
+    QCOMPARE(page.total, 2);
+    QCOMPARE(page.items[0].getId(), 3);
+    QCOMPARE(page.items[1].getId(), 1);
+
+    // Volunteers added after the keys were built are still ordered correctly
+    m_controller->addVolunteer(Volunteer(4, "Aaron", "aaron@example.com"));
+    page = m_controller->queryVolunteers(VolunteerFilter(), VolunteerSortKey::Name, 0, 1);
+    QCOMPARE(page.items[0].getId(), 4);
+}
+
+void TestVolunteerManagement::testControllerUpcomingEvents()
+{
+    auto volunteerRepo = std::make_unique<CSVVolunteerRepository>(m_volunteerCsvPath);
+    auto eventRepo = std::make_unique<CSVEventRepository>(m_eventCsvPath);
+    m_controller = std::make_unique<Controller>(std::move(volunteerRepo), std::move(eventRepo));
+
+    m_controller->addEvent(Event(1, "Past", QDate(2024, 1, 1), "Hall"));
+    m_controller->addEvent(Event(2, "Later", QDate(2024, 3, 1), "Hall"));
+    m_controller->addEvent(Event(3, "Sooner", QDate(2024, 2, 1), "Hall"));
+    m_controller->addEvent(Event(4, "Same Day", QDate(2024, 2, 1), "Park"));
+
+    std::vector<Event> upcoming = m_controller->upcomingEvents(QDate(2024, 1, 15), 2);
+    QCOMPARE(upcoming.size(), 2);
+    QCOMPARE(upcoming[0].getId(), 3);
+    QCOMPARE(upcoming[1].getId(), 4);
+
+    // Changes made after the index exists are reflected, including undo/redo
+    m_controller->updateEvent(2, Event(2, "Later", QDate(2024, 1, 20), "Hall"));
+    upcoming = m_controller->upcomingEvents(QDate(2024, 1, 15), 1);
+    QCOMPARE(upcoming[0].getId(), 2);
+
+    m_controller->undo();
+    upcoming = m_controller->upcomingEvents(QDate(2024, 1, 15), 10);
+    QCOMPARE(upcoming.size(), 3);
+    QCOMPARE(upcoming[2].getId(), 2);
+
+    m_controller->removeEvent(3);
+    upcoming = m_controller->upcomingEvents(QDate(2024, 1, 15), 10);
+    QCOMPARE(upcoming.size(), 2);
+    QCOMPARE(upcoming[0].getId(), 4);
+
+    m_controller->undo();
+    m_controller->addEvent(Event(5, "New", QDate(2024, 1, 16), "Park"));
+    upcoming = m_controller->upcomingEvents(QDate(2024, 1, 15), 2);
+    QCOMPARE(upcoming[0].getId(), 5);
+    QCOMPARE(upcoming[1].getId(), 3);
+}
+
+void TestVolunteerManagement::testControllerAggregates()
+{
+    auto volunteerRepo = std::make_unique<CSVVolunteerRepository>(m_volunteerCsvPath);
+    auto eventRepo = std::make_unique<CSVEventRepository>(m_eventCsvPath);
+    m_controller = std::make_unique<Controller>(std::move(volunteerRepo), std::move(eventRepo));
+
+    m_controller->addVolunteer(Volunteer(1, "Alice", "alice@example.com"));
+    m_controller->addVolunteer(Volunteer(2, "Bob", "bob@example.com"));
+    m_controller->addEvent(Event(100, "Cleanup", QDate(2024, 6, 15), "Central Park"));
+    m_controller->addEvent(Event(101, "Food Drive", QDate(2024, 6, 20), "Central Park"));
+    m_controller->addEvent(Event(102, "Reading", QDate(2024, 7, 1), "Library"));
+
+    m_controller->addVolunteerToEvent(1, 100);
+    m_controller->addVolunteerToEvent(2, 100);
+    m_controller->addVolunteerToEvent(1, 102);
+
+    const EventAggregates& aggregates = m_controller->aggregates();
+    QCOMPARE(aggregates.eventsAtLocation("Central Park"), 2);
+    QCOMPARE(aggregates.eventsAtLocation("Library"), 1);
+    QCOMPARE(aggregates.assignmentsInMonth(2024, 6), 2);
+    QCOMPARE(aggregates.assignmentsInMonth(2024, 7), 1);
+    QCOMPARE(aggregates.eventsForVolunteer(1), 2);
+    QCOMPARE(aggregates.eventsForVolunteer(2), 1);
+
+    // Moving an event to another month and place shifts its counters
+    Event moved(100, "Cleanup", QDate(2024, 7, 5), "Library");
+    moved.addVolunteer(1);
+    moved.addVolunteer(2);
+    m_controller->updateEvent(100, moved);
+    QCOMPARE(aggregates.eventsAtLocation("Central Park"), 1);
+    QCOMPARE(aggregates.eventsAtLocation("Library"), 2);
+    QCOMPARE(aggregates.assignmentsInMonth(2024, 6), 0);
+    QCOMPARE(aggregates.assignmentsInMonth(2024, 7), 3);
+
+    m_controller->undo();
+    QCOMPARE(aggregates.assignmentsInMonth(2024, 6), 2);
+    QCOMPARE(aggregates.eventsAtLocation("Central Park"), 2);
+
+    m_controller->removeVolunteerFromEvent(1, 102);
+    m_controller->removeEvent(101);
+    QCOMPARE(aggregates.eventsForVolunteer(1), 1);
+    QCOMPARE(aggregates.assignmentsInMonth(2024, 7), 0);
+    QCOMPARE(aggregates.eventsAtLocation("Central Park"), 1);
+
+    QVERIFY(m_controller->verifyAggregates());
+}
+
+void TestVolunteerManagement::testControllerDoubleBooking()
+{
+    auto volunteerRepo = std::make_unique<CSVVolunteerRepository>(m_volunteerCsvPath);
+    auto eventRepo = std::make_unique<CSVEventRepository>(m_eventCsvPath);
+    m_controller = std::make_unique<Controller>(std::move(volunteerRepo), std::move(eventRepo));
+
+    m_controller->addVolunteer(Volunteer(1, "Alice", "alice@example.com"));
+    m_controller->addEvent(Event(100, "Cleanup", QDate(2024, 6, 15), "Central Park"));
+    m_controller->addEvent(Event(101, "Food Drive", QDate(2024, 6, 15), "Library"));
+    m_controller->addEvent(Event(102, "Reading", QDate(2024, 6, 16), "Library"));
+
+    QVERIFY(m_controller->addVolunteerToEvent(1, 100));
+    QVERIFY(!m_controller->addVolunteerToEvent(1, 101)); // Same day as Cleanup
+    QVERIFY(m_controller->addVolunteerToEvent(1, 102));
+    QVERIFY(m_controller->addVolunteerToEvent(1, 100)); // Re-assigning to the same event is not a conflict
+    QVERIFY(!m_controller->addVolunteerToEvent(1, 999));
+    QVERIFY(m_controller->findBookingConflicts().empty());
+
+    // Freeing the slot makes the assignment possible again
+    m_controller->removeVolunteerFromEvent(1, 100);
+    QVERIFY(m_controller->addVolunteerToEvent(1, 101));
+    m_controller->removeVolunteerFromEvent(1, 101);
+    QVERIFY(m_controller->addVolunteerToEvent(1, 100));
+
+    // Under the warn policy the assignment goes through and shows up in the report
+    m_controller->setDoubleBookingPolicy(DoubleBookingPolicy::Warn);
+    QVERIFY(m_controller->addVolunteerToEvent(1, 101));
+    std::vector<BookingConflict> conflicts = m_controller->findBookingConflicts();
+    QCOMPARE(conflicts.size(), 1);
+    QCOMPARE(conflicts[0].volunteerId, 1);
+    QCOMPARE(conflicts[0].date, QDate(2024, 6, 15));
+    QCOMPARE(conflicts[0].eventIds, QList<int>({100, 101}));
+
+    // Moving an event off the shared day resolves the conflict
+    Event moved(101, "Food Drive", QDate(2024, 6, 17), "Library");
+    moved.addVolunteer(1);
+    m_controller->updateEvent(101, moved);
+    QVERIFY(m_controller->findBookingConflicts().empty());
+    m_controller->undo();
+    QCOMPARE(m_controller->findBookingConflicts().size(), 1);
+}
+
+void TestVolunteerManagement::testControllerAssignedIds()
+{
+    auto volunteerRepo = std::make_unique<CSVVolunteerRepository>(m_volunteerCsvPath);
+    auto eventRepo = std::make_unique<CSVEventRepository>(m_eventCsvPath);
+    m_controller = std::make_unique<Controller>(std::move(volunteerRepo), std::move(eventRepo));
+
+    m_controller->addVolunteer(Volunteer(5, "Alice", "alice@example.com"));
+    QCOMPARE(m_controller->addVolunteer("Bob", "bob@example.com"), 6);
+    QCOMPARE(m_controller->addVolunteer("Charlie", "charlie@example.com"), 7);
+    QCOMPARE(m_controller->addEvent("Cleanup", QDate(2024, 6, 15), "Central Park"), 1);
+
+    // Freed IDs are reused; undoing the reuse frees the ID again for the undone removal
+    m_controller->removeVolunteer(6);
+    QCOMPARE(m_controller->addVolunteer("Dana", "dana@example.com"), 6);
+    m_controller->undo();
+    m_controller->undo();
+    QCOMPARE(m_controller->getAllVolunteers().size(), 3);
+
+    // Imports with assigned IDs never collide, even when the rows reuse stored IDs
+    std::vector<Volunteer> incoming = {Volunteer(5, "Eve", "eve@example.com"), Volunteer(5, "Frank", "frank@example.com")};
+    ImportResult result = m_controller->importVolunteers(incoming, ImportIds::Assign);
+    QCOMPARE(result.imported, 2);
+    QVERIFY(!result.hasIssues());
+    QCOMPARE(m_controller->getAllVolunteers().size(), 5);
+
+    // The allocator state survives a reload
+    m_controller.reset();
+    volunteerRepo = std::make_unique<CSVVolunteerRepository>(m_volunteerCsvPath);
+    eventRepo = std::make_unique<CSVEventRepository>(m_eventCsvPath);
+    m_controller = std::make_unique<Controller>(std::move(volunteerRepo), std::move(eventRepo));
+    m_controller->removeVolunteer(7);
+    QCOMPARE(m_controller->addVolunteer("Grace", "grace@example.com"), 7);
+    QCOMPARE(m_controller->addVolunteer("Heidi", "heidi@example.com"), 10);
+
+    // Rejected rows take no ID, and their issues carry the row's own ID
+    incoming = {Volunteer(42, "", "nobody@example.com"), Volunteer(43, "Ivan", "ivan@example.com")};
+    result = m_controller->importVolunteers(incoming, ImportIds::Assign);
+    QCOMPARE(result.imported, 1);
+    QCOMPARE(result.issues.size(), std::size_t(1));
+    QCOMPARE(result.issues.front().id, 42);
+    QCOMPARE(m_controller->findVolunteer(11)->getName(), QString("Ivan"));
+    QCOMPARE(m_controller->addVolunteer("Judy", "judy@example.com"), 12);
+}
+
+void TestVolunteerManagement::testControllerChangeNotifications()
+{
+    auto volunteerRepo = std::make_unique<CSVVolunteerRepository>(m_volunteerCsvPath);
+    auto eventRepo = std::make_unique<CSVEventRepository>(m_eventCsvPath);
+    m_controller = std::make_unique<Controller>(std::move(volunteerRepo), std::move(eventRepo));
+
+    QStringList log;
+    ChangeNotifier* notifier = m_controller->changeNotifier();
+    QObject::connect(notifier, &ChangeNotifier::volunteerAdded, [&log](const Volunteer& v) { log << QString("v+%1").arg(v.getId()); });
+    QObject::connect(notifier, &ChangeNotifier::volunteerRemoved, [&log](const Volunteer& v) { log << QString("v-%1").arg(v.getId()); });
+    QObject::connect(notifier, &ChangeNotifier::volunteerUpdated, [&log](const Volunteer& oldV, const Volunteer& newV) {
+        log << QString("v~%1:%2>%3").arg(newV.getId()).arg(oldV.getName(), newV.getName());
+    });
+    QObject::connect(notifier, &ChangeNotifier::eventAdded, [&log](const Event& e) { log << QString("e+%1").arg(e.getId()); });
+    QObject::connect(notifier, &ChangeNotifier::eventUpdated, [&log](const Event&, const Event& e) { log << QString("e~%1").arg(e.getId()); });
+    QObject::connect(notifier, &ChangeNotifier::volunteerAssigned, [&log](int eventId, int volunteerId) { log << QString("a+%1:%2").arg(eventId).arg(volunteerId); });
+    QObject::connect(notifier, &ChangeNotifier::volunteerUnassigned, [&log](int eventId, int volunteerId) { log << QString("a-%1:%2").arg(eventId).arg(volunteerId); });
+    QObject::connect(notifier, &ChangeNotifier::batchCommitted, [&log](int count) { log << QString("batch%1").arg(count); });
+
+    m_controller->addVolunteer(Volunteer(1, "Alice", "alice@example.com"));
+    m_controller->updateVolunteer(1, Volunteer(1, "Alicia", "alice@example.com"));
+    m_controller->addEvent(Event(100, "Cleanup", QDate(2024, 6, 15), "Central Park"));
+    m_controller->addVolunteerToEvent(1, 100);
+    m_controller->removeVolunteerFromEvent(1, 100);
+    QCOMPARE(log, QStringList({"v+1", "v~1:Alice>Alicia", "e+100", "e~100", "a+100:1", "e~100", "a-100:1"}));
+
+    // Imports emit one signal per row, then a single batch marker; undo mirrors it
+    log.clear();
+    std::vector<Volunteer> incoming = {Volunteer(2, "Bob", "bob@example.com"), Volunteer(3, "Charlie", "charlie@example.com")};
+    m_controller->importVolunteers(incoming);
+    m_controller->undo();
+    QCOMPARE(log, QStringList({"v+2", "v+3", "batch2", "v-2", "v-3", "batch2"}));
+}
+
+void TestVolunteerManagement::testControllerRowAccess()
+{
+    auto volunteerRepo = std::make_unique<CSVVolunteerRepository>(m_volunteerCsvPath);
+    auto eventRepo = std::make_unique<CSVEventRepository>(m_eventCsvPath);
+    m_controller = std::make_unique<Controller>(std::move(volunteerRepo), std::move(eventRepo));
+
+    m_controller->addVolunteer(Volunteer(10, "Alice", "alice@example.com"));
+    m_controller->addVolunteer(Volunteer(20, "Bob", "bob@example.com"));
+    m_controller->addVolunteer(Volunteer(30, "Charlie", "charlie@example.com"));
+    m_controller->addEvent(Event(100, "Cleanup", QDate(2024, 6, 15), "Central Park"));
+
+    QCOMPARE(m_controller->volunteerCount(), 3);
+    QCOMPARE(m_controller->volunteerRow(20), 1);
+    QCOMPARE(m_controller->volunteerAt(1).getName(), QString("Bob"));
+    QCOMPARE(m_controller->volunteerRow(99), -1);
+    QCOMPARE(m_controller->eventCount(), 1);
+    QCOMPARE(m_controller->eventAt(m_controller->eventRow(100)).getTitle(), QString("Cleanup"));
+
+    // Rows after a removed item shift up and the index follows
+    m_controller->removeVolunteer(10);
+    QCOMPARE(m_controller->volunteerCount(), 2);
+    QCOMPARE(m_controller->volunteerRow(30), 1);
+    QCOMPARE(m_controller->volunteerAt(0).getId(), 20);
+}
+
+void TestVolunteerManagement::testFilterEventIdsCancellation()
+{
+    std::vector<Event> events;
+    for (int i = 1; i <= 10000; ++i) {
+        events.emplace_back(i, "Event", QDate(2024, 1, 1).addDays(i % 7), i % 2 == 0 ? "Central Park" : "Library");
+    }
+
+    EventFilter filter;
+    filter.locationContains = "park";
+    filter.from = QDate(2024, 1, 1);
+    filter.to = QDate(2024, 1, 1);
+
+    std::optional<std::vector<int>> ids = filterEventIds(events, filter, []() { return false; });
+    QVERIFY(ids.has_value());
+    QCOMPARE(ids->front(), 14); // Even and a multiple of 7
+    QVERIFY(std::all_of(ids->begin(), ids->end(), [](int id) { return id % 14 == 0; }));
+    QCOMPARE(ids->size(), 10000 / 14);
+
+    // A cancelled scan stops at the next poll and reports no result
+    int polls = 0;
+    ids = filterEventIds(events, filter, [&polls]() { return ++polls > 1; });
+    QVERIFY(!ids.has_value());
+    QCOMPARE(polls, 2);
+}
+
+void TestVolunteerManagement::testControllerFindById()
+{
+    auto volunteerRepo = std::make_unique<CSVVolunteerRepository>(m_volunteerCsvPath);
+    auto eventRepo = std::make_unique<CSVEventRepository>(m_eventCsvPath);
+    m_controller = std::make_unique<Controller>(std::move(volunteerRepo), std::move(eventRepo));
+
+    m_controller->addVolunteer(Volunteer(1, "Alice", "alice@example.com"));
+    m_controller->addVolunteer(Volunteer(2, "Bob", "bob@example.com"));
+    m_controller->addEvent(Event(100, "Cleanup", QDate(2024, 6, 15), "Central Park"));
+    m_controller->addVolunteerToEvent(2, 100);
+
+    const Volunteer* bob = m_controller->findVolunteer(2);
+    QVERIFY(bob != nullptr);
+    QCOMPARE(bob->getName(), QString("Bob"));
+    QVERIFY(m_controller->findVolunteer(3) == nullptr);
+
+    const Event* cleanup = m_controller->findEvent(100);
+    QVERIFY(cleanup != nullptr);
+    QCOMPARE(cleanup->getVolunteerIds(), QList<int>({2}));
+
+    m_controller->removeEvent(100);
+    QVERIFY(m_controller->findEvent(100) == nullptr);
+}
+
+void TestVolunteerManagement::testControllerMetrics()
+{
+    // Bucket bounds stay within 1/16 of the recorded value
+    LatencyHistogram histogram;
+    for (quint64 ns = 1; ns <= 1000; ++ns) {
+        histogram.record(ns * 1000);
+    }
+    HistogramSnapshot latency = histogram.snapshot();
+    QCOMPARE(latency.count, quint64(1000));
+    QCOMPARE(latency.maxNs, quint64(1000000));
+    QVERIFY(latency.p50Ns >= 500000 && latency.p50Ns <= 500000 + 500000 / 16);
+    QVERIFY(latency.p99Ns >= 990000 && latency.p99Ns <= 1000000);
+
+    auto volunteerRepo = std::make_unique<CSVVolunteerRepository>(m_volunteerCsvPath);
+    auto eventRepo = std::make_unique<CSVEventRepository>(m_eventCsvPath);
+    m_controller = std::make_unique<Controller>(std::move(volunteerRepo), std::move(eventRepo));
+
+    // The registry is process-wide, so compare against a baseline
+    const MetricsSnapshot before = m_controller->metricsSnapshot();
+    m_controller->addEvent(Event(100, "Cleanup", QDate(2024, 6, 15), "Central Park"));
+    m_controller->undo();
+    m_controller->undo();
+    const MetricsSnapshot after = m_controller->metricsSnapshot();
+
+    QCOMPARE(after.histograms.value("controller.add_event").count - before.histograms.value("controller.add_event").count, quint64(1));
+    QCOMPARE(after.histograms.value("controller.undo").count - before.histograms.value("controller.undo").count, quint64(2));
+    QCOMPARE(after.counters.value("controller.undo_empty") - before.counters.value("controller.undo_empty"), quint64(1));
+    QVERIFY(after.histograms.value("repository.csv_events.save").count >= before.histograms.value("repository.csv_events.save").count + 2);
+
+    QVERIFY(after.toJson().contains("\"controller.add_event\""));
+    const QByteArray prometheus = after.toPrometheus();
+    QVERIFY(prometheus.contains("# TYPE volunteer_controller_add_event_seconds summary"));
+    QVERIFY(prometheus.contains("volunteer_controller_undo_empty_total"));
+
+    const QString dumpPath = m_tempDir + "/metrics.prom";
+    MetricsDumper dumper(dumpPath, MetricsFormat::Prometheus, 60000);
+    QVERIFY(dumper.dumpNow());
+    QFile dump(dumpPath);
+    QVERIFY(dump.open(QIODevice::ReadOnly));
+    QVERIFY(dump.readAll().contains("volunteer_controller_add_event_seconds_count"));
+}
+
+void TestVolunteerManagement::testTraceExport()
+{
+#ifdef VOLUNTEER_DISABLE_TRACING
+    QSKIP("Tracing is compiled out");
+#endif
+    auto volunteerRepo = std::make_unique<CSVVolunteerRepository>(m_volunteerCsvPath);
+    auto eventRepo = std::make_unique<CSVEventRepository>(m_eventCsvPath);
+    m_controller = std::make_unique<Controller>(std::move(volunteerRepo), std::move(eventRepo));
+
+    // Nothing is recorded while tracing is off
+    Tracer::clear();
+    m_controller->addEvent(Event(100, "Cleanup", QDate(2024, 6, 15), "Central Park"));
+    QCOMPARE(Tracer::spanCount(), std::size_t(0));
+
+    Tracer::setEnabled(true);
+    m_controller->updateEvent(100, Event(100, "Cleanup", QDate(2024, 6, 16), "Central Park"));
+    Tracer::setEnabled(false);
+
+    const QString tracePath = m_tempDir + "/trace.json";
+    QVERIFY(Tracer::exportChromeTrace(tracePath));
+    QFile traceFile(tracePath);
+    QVERIFY(traceFile.open(QIODevice::ReadOnly));
+    QJsonParseError error;
+    const QJsonDocument document = QJsonDocument::fromJson(traceFile.readAll(), &error);
+    QCOMPARE(error.error, QJsonParseError::NoError);
+
+    // Controller -> Command -> Repository -> file I/O, each nested inside its caller
+    QMap<QString, QJsonObject> spans;
+    for (const QJsonValue& value : document.object().value("traceEvents").toArray()) {
+        const QJsonObject span = value.toObject();
+        if (span.value("ph").toString() == "X") {
+            spans.insert(span.value("name").toString(), span);
+        }
+    }
+    const QStringList chain = {"Controller::updateEvent", "UpdateEventCommand::execute",
+                               "CSVEventRepository::update", "CSVEventRepository::save"};
+    for (int i = 0; i < chain.size(); ++i) {
+        QVERIFY2(spans.contains(chain[i]), qPrintable(chain[i]));
+        if (i > 0) {
+            const QJsonObject outer = spans.value(chain[i - 1]);
+            const QJsonObject inner = spans.value(chain[i]);
+            QVERIFY(inner.value("ts").toDouble() >= outer.value("ts").toDouble());
+            QVERIFY(inner.value("ts").toDouble() + inner.value("dur").toDouble()
+                    <= outer.value("ts").toDouble() + outer.value("dur").toDouble() + 0.001);
+        }
+    }
+    QCOMPARE(spans.value("CSVEventRepository::save").value("cat").toString(), QString("io"));
+    Tracer::clear();
+}
+
+void TestVolunteerManagement::testControllerMemoryUsage()
+{
+    auto volunteerRepo = std::make_unique<CSVVolunteerRepository>(m_volunteerCsvPath);
+    auto eventRepo = std::make_unique<CSVEventRepository>(m_eventCsvPath);
+    m_controller = std::make_unique<Controller>(std::move(volunteerRepo), std::move(eventRepo));
+
+    MemoryReport empty = m_controller->memoryUsage();
+    QCOMPARE(empty.volunteers.items, std::size_t(0));
+    QCOMPARE(empty.undoStack.totalBytes(), std::size_t(0));
+
+    const QString longName(1000, QChar('a'));
+    m_controller->addVolunteer(Volunteer(1, longName, "alice@example.com"));
+    m_controller->addVolunteer(Volunteer(2, "Bob", "bob@example.com"));
+    m_controller->addEvent(Event(100, "Cleanup", QDate(2024, 6, 15), "Central Park"));
+    m_controller->addVolunteerToEvent(1, 100);
+
+    MemoryReport report = m_controller->memoryUsage();
+    QCOMPARE(report.volunteers.items, std::size_t(2));
+    QVERIFY(report.volunteers.objectBytes >= 2 * sizeof(Volunteer));
+    QVERIFY(report.volunteers.stringBytes >= longName.size() * sizeof(QChar));
+    QVERIFY(report.volunteers.indexBytes > 0);
+    QCOMPARE(report.events.items, std::size_t(1));
+    QVERIFY(report.events.listBytes >= sizeof(int));
+    // Three add commands; assignments are applied directly and are not undoable
+    QCOMPARE(report.undoStack.items, std::size_t(3));
+    // Added items were moved into storage, so the commands hold no string data of their own
+    QCOMPARE(report.undoStack.stringBytes, std::size_t(0));
+    QCOMPARE(report.redoStack.items, std::size_t(0));
+    QVERIFY(report.indexes.indexBytes > 0); // Booking slots and aggregates
+    QCOMPARE(report.indexes.objectBytes, std::size_t(0)); // Snapshot reads are off
+
+    // Sort keys built by the first sorted query and snapshot chunks are counted too
+    m_controller->queryVolunteers(VolunteerFilter(), VolunteerSortKey::Name, 0, -1);
+    QVERIFY(m_controller->memoryUsage().indexes.indexBytes >= report.indexes.indexBytes + longName.size() * sizeof(QChar));
+    m_controller->setSnapshotReads(true);
+    QVERIFY(m_controller->memoryUsage().indexes.objectBytes >= 2 * sizeof(Volunteer) + sizeof(Event));
+    m_controller->setSnapshotReads(false);
+
+    m_controller->undo();
+    report = m_controller->memoryUsage();
+    QCOMPARE(report.undoStack.items, std::size_t(2));
+    QCOMPARE(report.redoStack.items, std::size_t(1));
+    QVERIFY(report.redoStack.stringBytes > 0); // The undone event now lives in its command
+
+    const MetricsSnapshot snapshot = m_controller->metricsSnapshot();
+    QCOMPARE(snapshot.gauges.value("memory.volunteers.items"), qint64(2));
+    QCOMPARE(snapshot.gauges.value("memory.events.bytes"), qint64(report.events.totalBytes()));
+    QCOMPARE(snapshot.gauges.value("memory.indexes.bytes"), qint64(report.indexes.totalBytes()));
+    QCOMPARE(snapshot.gauges.value("memory.total_bytes"), qint64(report.totalBytes()));
+    QVERIFY(snapshot.toPrometheus().contains("# TYPE volunteer_memory_undo_stack_bytes gauge"));
+}
+
+void TestVolunteerManagement::testOperationRecordReplay()
+{
+    auto volunteerRepo = std::make_unique<CSVVolunteerRepository>(m_volunteerCsvPath);
+    auto eventRepo = std::make_unique<CSVEventRepository>(m_eventCsvPath);
+    m_controller = std::make_unique<Controller>(std::move(volunteerRepo), std::move(eventRepo));
+
+    const QString logPath = m_tempDir + "/session.vlog";
+    QVERIFY(m_controller->startRecording(logPath));
+    m_controller->addVolunteer(Volunteer(1, "Alice", "alice@example.com"));
+    m_controller->addVolunteer(Volunteer(2, "Bob", "bob@example.com"));
+    m_controller->addEvent(Event(100, "Cleanup", QDate(2024, 6, 15), "Central Park"));
+    m_controller->addVolunteerToEvent(1, 100);
+    const Event* cleanup = m_controller->findEvent(100);
+    QVERIFY(cleanup != nullptr);
+    Event renamed = *cleanup;
+    renamed.setTitle("Park Cleanup");
+    m_controller->updateEvent(100, renamed);
+    m_controller->filterEventsByLocation("park");
+    m_controller->addEvent(Event(101, "Food Drive", QDate(2024, 7, 1), "Library"));
+    m_controller->undo();
+    m_controller->redo();
+    m_controller->removeVolunteer(2);
+    // Imports are recorded too, so the undo after one replays against the same command
+    m_controller->importEvents({Event(200, "Fair", QDate(2024, 9, 1), "Square", QList<int>{1}),
+                                Event(201, "Market", QDate(2024, 9, 2), "Square")});
+    m_controller->undo();
+    m_controller->stopRecording();
+
+    std::vector<RecordedOperation> operations;
+    QVERIFY(OperationLog::read(logPath, operations));
+    QCOMPARE(operations.size(), std::size_t(12));
+    QCOMPARE(operations[3].type, OperationType::AssignVolunteer);
+    QCOMPARE(operations[3].id, 1);
+    QCOMPARE(operations[3].otherId, 100);
+    QCOMPARE(operations[4].event().getTitle(), QString("Park Cleanup"));
+    QCOMPARE(operations[4].volunteerIds, QList<int>({1}));
+    QCOMPARE(operations[5].text, QString("park"));
+    QCOMPARE(operations[7].type, OperationType::Undo);
+    QCOMPARE(operations[10].type, OperationType::ImportEvents);
+    QCOMPARE(operations[10].importedEvents.size(), std::size_t(2));
+    QCOMPARE(operations[10].importedEvents[0].getVolunteerIds(), QList<int>({1}));
+
+    // The same session against the other backend ends in the same state
+    Controller replayed(std::make_unique<JSONVolunteerRepository>(m_tempDir + "/replay_volunteers.json"),
+                        std::make_unique<JSONEventRepository>(m_tempDir + "/replay_events.json"));
+    const ReplayReport report = OperationReplayer::replay(replayed, operations);
+    QCOMPARE(report.operations, qint64(12));
+    QCOMPARE(report.latency[static_cast<std::size_t>(OperationType::AddEvent)].count, quint64(2));
+    QVERIFY(report.toJson().contains("\"assign_volunteer\""));
+
+    QCOMPARE(replayed.volunteerCount(), 1);
+    QCOMPARE(replayed.eventCount(), 2);
+    const Event* replayedCleanup = replayed.findEvent(100);
+    QVERIFY(replayedCleanup != nullptr);
+    QCOMPARE(replayedCleanup->getTitle(), QString("Park Cleanup"));
+    QCOMPARE(replayedCleanup->getVolunteerIds(), QList<int>({1}));
+    QVERIFY(replayed.findEvent(101) != nullptr);
+}
+
+void TestVolunteerManagement::testFileRepositorySchemaCodec()
+{
+    QString line;
+    QTextStream out(&line);
+    Event event(7, "Beach Cleanup", QDate(2024, 8, 3), "Pier");
+    event.addVolunteer(1);
+    event.addVolunteer(4);
+    DelimitedLineCodec::write(out, event);
+    DelimitedLineCodec::write(out, Volunteer(3, "Carol", "carol@example.com"));
+    out.flush();
+    QCOMPARE(line, QString("7,Beach Cleanup,2024-08-03,Pier,1,4\n3,Carol,carol@example.com\n"));
+
+    const std::optional<Event> decoded = DelimitedLineCodec::read<Event>("7,Beach Cleanup,2024-08-03,Pier,1,x,4");
+    QVERIFY(decoded.has_value());
+    QCOMPARE(decoded->getDate(), QDate(2024, 8, 3));
+    QCOMPARE(decoded->getVolunteerIds(), QList<int>({1, 4})); // Invalid list entries are skipped
+    QVERIFY(!DelimitedLineCodec::read<Event>("7,Beach Cleanup,2024-08-03").has_value());
+    QVERIFY(!DelimitedLineCodec::read<Volunteer>("3,Carol,carol@example.com,extra").has_value());
+
+    // Both formats share the stored layout, so a CSV file loads through the JSON repository
+    {
+        CSVEventRepository csvRepo(m_eventCsvPath);
+        csvRepo.add(event);
+        csvRepo.add(Event(8, "Food Drive", QDate(2024, 9, 1), "Library"));
+    }
+    const QString jsonPath = m_tempDir + "/copied_events.json";
+    QVERIFY(QFile::copy(m_eventCsvPath, jsonPath));
+    JSONEventRepository jsonRepo(jsonPath);
+    QCOMPARE(jsonRepo.count(), std::size_t(2));
+    QCOMPARE(jsonRepo.findById(7)->getVolunteerIds(), QList<int>({1, 4}));
+    QCOMPARE(jsonRepo.findById(8)->getLocation(), QString("Library"));
+    QCOMPARE(jsonRepo.nextId(), 9);
+}
+
+void TestVolunteerManagement::testMoveAndEmplaceMutations()
+{
+    Event withDuplicates(1, "Dup", QDate(2024, 1, 1), "Hall", QList<int>({3, 1, 3, 2, 1}));
+    QCOMPARE(withDuplicates.getVolunteerIds(), QList<int>({3, 1, 2}));
+
+    {
+        CSVEventRepository repo(m_eventCsvPath);
+        repo.emplace(7, QString("Beach Cleanup"), QDate(2024, 8, 3), QString("Pier"), QList<int>({1, 4}));
+        QCOMPARE(repo.findById(7)->getVolunteerIds(), QList<int>({1, 4}));
+
+        std::optional<Event> previous = repo.replace(Event(7, "Dune Cleanup", QDate(2024, 8, 3), "Pier"));
+        QVERIFY(previous.has_value());
+        QCOMPARE(previous->getTitle(), QString("Beach Cleanup"));
+        QCOMPARE(repo.findById(7)->getTitle(), QString("Dune Cleanup"));
+        QVERIFY(!repo.replace(Event(8, "Missing", QDate(2024, 8, 4), "Pier")).has_value());
+
+        std::optional<Event> taken = repo.take(7);
+        QVERIFY(taken.has_value());
+        QCOMPARE(taken->getTitle(), QString("Dune Cleanup"));
+        QCOMPARE(repo.count(), std::size_t(0));
+        QVERIFY(!repo.take(7).has_value());
+    }
+
+    auto volunteerRepo = std::make_unique<CSVVolunteerRepository>(m_volunteerCsvPath);
+    auto eventRepo = std::make_unique<CSVEventRepository>(m_eventCsvPath);
+    m_controller = std::make_unique<Controller>(std::move(volunteerRepo), std::move(eventRepo));
+
+    m_controller->emplaceVolunteer(1, QString("Alice"), QString("alice@example.com"));
+    m_controller->emplaceEvent(100, QString("Cleanup"), QDate(2024, 6, 15), QString("Central Park"));
+    Event renamed = *m_controller->findEvent(100);
+    renamed.setTitle("Park Cleanup");
+    m_controller->updateEvent(100, std::move(renamed));
+    QCOMPARE(m_controller->findEvent(100)->getTitle(), QString("Park Cleanup"));
+
+    // Commands swap versions with storage, so undo and redo keep working after the moves
+    m_controller->undo();
+    QCOMPARE(m_controller->findEvent(100)->getTitle(), QString("Cleanup"));
+    m_controller->redo();
+    QCOMPARE(m_controller->findEvent(100)->getTitle(), QString("Park Cleanup"));
+    m_controller->removeVolunteer(1);
+    QVERIFY(m_controller->findVolunteer(1) == nullptr);
+    m_controller->undo();
+    QVERIFY(m_controller->findVolunteer(1) != nullptr);
+    QCOMPARE(m_controller->findVolunteer(1)->getName(), QString("Alice"));
+}
+
+void TestVolunteerManagement::testControllerUpdateEventFields()
+{
+    auto volunteerRepo = std::make_unique<CSVVolunteerRepository>(m_volunteerCsvPath);
+    auto eventRepo = std::make_unique<CSVEventRepository>(m_eventCsvPath);
+    m_controller = std::make_unique<Controller>(std::move(volunteerRepo), std::move(eventRepo));
+
+    m_controller->addVolunteer(Volunteer(1, "Alice", "alice@example.com"));
+    m_controller->addEvent(Event(100, "Cleanup", QDate(2024, 6, 15), "Central Park"));
+    m_controller->addEvent(Event(101, "Food Drive", QDate(2024, 7, 1), "Library"));
+    QVERIFY(m_controller->addVolunteerToEvent(1, 100));
+    QCOMPARE(m_controller->upcomingEvents(QDate(2024, 1, 1), 1).front().getId(), 100);
+
+    EventFieldValues values;
+    values.date = QDate(2024, 8, 1);
+    values.title = "Ignored"; // Not in the mask
+    m_controller->updateEventFields(100, EventField::Date, values);
+
+    const Event* patched = m_controller->findEvent(100);
+    QVERIFY(patched != nullptr);
+    QCOMPARE(patched->getDate(), QDate(2024, 8, 1));
+    QCOMPARE(patched->getTitle(), QString("Cleanup"));
+    QCOMPARE(patched->getVolunteerIds(), QList<int>({1}));
+    QCOMPARE(m_controller->upcomingEvents(QDate(2024, 1, 1), 1).front().getId(), 101);
+    QVERIFY(m_controller->verifyAggregates());
+
+    // The undo record holds only the replaced date
+    QCOMPARE(m_controller->memoryUsage().undoStack.stringBytes, std::size_t(0));
+
+    m_controller->undo();
+    QCOMPARE(m_controller->findEvent(100)->getDate(), QDate(2024, 6, 15));
+    QCOMPARE(m_controller->upcomingEvents(QDate(2024, 1, 1), 1).front().getId(), 100);
+    m_controller->redo();
+    QCOMPARE(m_controller->findEvent(100)->getDate(), QDate(2024, 8, 1));
+
+    EventFieldValues moved;
+    moved.location = "Riverside";
+    moved.volunteerIds = {};
+    m_controller->updateEventFields(100, EventField::Location | EventField::Volunteers, std::move(moved));
+    QCOMPARE(m_controller->findEvent(100)->getLocation(), QString("Riverside"));
+    QVERIFY(m_controller->findEvent(100)->getVolunteerIds().isEmpty());
+    QCOMPARE(m_controller->aggregates().eventsPerLocation().value("Riverside"), 1);
+    QVERIFY(m_controller->verifyAggregates());
+    m_controller->undo();
+    QCOMPARE(m_controller->findEvent(100)->getLocation(), QString("Central Park"));
+    QCOMPARE(m_controller->findEvent(100)->getVolunteerIds(), QList<int>({1}));
+
+    // Patches are persisted like full updates
+    CSVEventRepository reloaded(m_eventCsvPath);
+    const Event* stored = reloaded.findById(100);
+    QVERIFY(stored != nullptr);
+    QCOMPARE(stored->getDate(), QDate(2024, 8, 1));
+    QCOMPARE(stored->getLocation(), QString("Central Park"));
+}
+
+void TestVolunteerManagement::testControllerQueryCache()
+{
+    auto volunteerRepo = std::make_unique<CSVVolunteerRepository>(m_volunteerCsvPath);
+    auto eventRepo = std::make_unique<CSVEventRepository>(m_eventCsvPath);
+    m_controller = std::make_unique<Controller>(std::move(volunteerRepo), std::move(eventRepo));
+
+    m_controller->addEvent(Event(1, "Cleanup", QDate(2024, 6, 15), "Central Park"));
+    m_controller->addEvent(Event(2, "Food Drive", QDate(2024, 7, 1), "Library"));
+    m_controller->addEvent(Event(3, "Planting", QDate(2024, 6, 15), "Park Lane"));
+
+    Counter& hits = MetricsRegistry::instance().counter("query_cache.event_filter.hits");
+    Counter& misses = MetricsRegistry::instance().counter("query_cache.event_filter.misses");
+    Counter& evictions = MetricsRegistry::instance().counter("query_cache.event_filter.evictions");
+    const quint64 hitsBefore = hits.value();
+    const quint64 missesBefore = misses.value();
+
+    EventFilter park;
+    park.locationContains = "park";
+    const auto first = m_controller->matchingEventIds(park);
+    QCOMPARE(*first, std::vector<int>({1, 3}));
+    EventFilter shouting;
+    shouting.locationContains = "PARK"; // Same normalized query
+    QCOMPARE(m_controller->matchingEventIds(shouting).get(), first.get());
+    QCOMPARE(hits.value() - hitsBefore, quint64(1));
+    QCOMPARE(misses.value() - missesBefore, quint64(1));
+
+    // Any write moves the generation on, so the entry is stale without being touched
+    const std::uint64_t generation = m_controller->eventGeneration();
+    m_controller->addEvent(Event(4, "Picnic", QDate(2024, 8, 1), "Riverside Park"));
+    QVERIFY(m_controller->eventGeneration() > generation);
+    QVERIFY(m_controller->cachedEventIds(park) == nullptr);
+    QCOMPARE(*m_controller->matchingEventIds(park), std::vector<int>({1, 3, 4}));
+    QCOMPARE(m_controller->filterEventsByLocation("Park").size(), std::size_t(3));
+
+    QCOMPARE(m_controller->filterEventsByDate("2024-06-15").size(), std::size_t(2));
+    QVERIFY(m_controller->filterEventsByDate("2024-6-15").empty()); // Only exact yyyy-MM-dd matches
+    QCOMPARE(m_controller->filterEventsByDate("").size(), std::size_t(4));
+
+    // A result computed against an older generation is never served
+    EventFilter library;
+    library.locationContains = "library";
+    m_controller->cacheEventIds(library, generation, {2});
+    QVERIFY(m_controller->cachedEventIds(library) == nullptr);
+
+    const quint64 evictionsBefore = evictions.value();
+    m_controller->setQueryCacheCapacity(1);
+    m_controller->matchingEventIds(park);
+    m_controller->matchingEventIds(library);
+    QVERIFY(evictions.value() > evictionsBefore);
+    QVERIFY(m_controller->cachedEventIds(park) == nullptr);
+    QVERIFY(m_controller->cachedEventIds(library) != nullptr);
+}
+
+void TestVolunteerManagement::testControllerSnapshotReads()
+{
+    auto volunteerRepo = std::make_unique<CSVVolunteerRepository>(m_volunteerCsvPath);
+    auto eventRepo = std::make_unique<CSVEventRepository>(m_eventCsvPath);
+    m_controller = std::make_unique<Controller>(std::move(volunteerRepo), std::move(eventRepo));
+    QVERIFY(m_controller->snapshot() == nullptr);
+
+    m_controller->addVolunteer(Volunteer(1, "Alice", "alice@example.com"));
+    std::vector<Event> events;
+    for (int id = 1; id <= 600; ++id) { // More than one chunk
+        events.emplace_back(id, QString("Event %1").arg(id), QDate(2024, 1, 1).addDays(id), "Hall", QList<int>{1});
+    }
+    m_controller->importEvents(events);
+    m_controller->setSnapshotReads(true);
+    QVERIFY(m_controller->snapshotReads());
+
+    const std::shared_ptr<const ControllerSnapshot> before = m_controller->snapshot();
+    QVERIFY(before != nullptr);
+    QCOMPARE(before->events->count(), std::size_t(600));
+    QCOMPARE(before->events->at(550).getId(), 551);
+    QCOMPARE(before->volunteers->findById(1)->getName(), QString("Alice"));
+
+    // Writes publish new versions and leave the one already taken as it was
+    EventFieldValues values;
+    values.title = "Renamed";
+    m_controller->updateEventFields(3, EventField::Title, std::move(values));
+    m_controller->removeEvent(1);
+    const std::shared_ptr<const ControllerSnapshot> after = m_controller->snapshot();
+    QVERIFY(after->events->generation() > before->events->generation());
+    QCOMPARE(before->events->count(), std::size_t(600));
+    QCOMPARE(before->events->findById(3)->getTitle(), QString("Event 3"));
+    QCOMPARE(after->events->count(), std::size_t(599));
+    QCOMPARE(after->events->at(0).getId(), 2);
+    QCOMPARE(after->events->findById(3)->getTitle(), QString("Renamed"));
+    QVERIFY(after->events->findById(1) == nullptr);
+    QCOMPARE(after->volunteers.get(), before->volunteers.get()); // Unchanged repository, same version
+
+    // A worker exports the snapshot while this thread keeps writing
+    QFuture<qint64> exported = QtConcurrent::run([after]() {
+        QBuffer buffer;
+        buffer.open(QIODevice::WriteOnly);
+        return ReportExporter(after->volunteers, after->events).exportEvents(buffer, ExportOptions());
+    });
+    for (int id = 601; id <= 650; ++id) {
+        m_controller->addEvent(Event(id, "Late", QDate(2025, 1, 1), "Annex"));
+    }
+    QCOMPARE(exported.result(), qint64(599));
+    QCOMPARE(after->events->count(), std::size_t(599));
+    QCOMPARE(m_controller->snapshot()->events->count(), std::size_t(649));
+
+    m_controller->undo();
+    QCOMPARE(m_controller->snapshot()->events->count(), std::size_t(648));
+
+    m_controller->setSnapshotReads(false);
+    QVERIFY(m_controller->snapshot() == nullptr);
+    QCOMPARE(after->events->at(0).getId(), 2); // Still readable after the store is gone
+}
+
+void TestVolunteerManagement::testAsyncControllerOrdering()
+{
+    auto volunteerRepo = std::make_unique<CSVVolunteerRepository>(m_volunteerCsvPath);
+    auto eventRepo = std::make_unique<CSVEventRepository>(m_eventCsvPath);
+    AsyncController async(std::make_unique<Controller>(std::move(volunteerRepo), std::move(eventRepo)));
+
+    // Pipelined without waiting: each operation sees every one queued before it
+    QFuture<int> volunteerId = async.addVolunteer("Alice", "alice@example.com");
+    for (int id = 1; id <= 20; ++id) {
+        async.addEvent(Event(id, QString("Event %1").arg(id), QDate(2024, 5, id), "Hall"));
+    }
+    QFuture<bool> assigned = async.addVolunteerToEvent(1, 3);
+    async.removeEvent(20);
+    async.removeEvent(19);
+    async.undo(); // Brings back event 19 only
+    QFuture<std::vector<Event>> events = async.getAllEvents();
+    EventFilter hall;
+    hall.locationContains = "hall";
+    QFuture<std::shared_ptr<const std::vector<int>>> matching = async.matchingEventIds(hall);
+
+    QCOMPARE(volunteerId.result(), 1);
+    QVERIFY(assigned.result());
+    QCOMPARE(events.result().size(), std::size_t(19));
+    QCOMPARE(events.result().back().getId(), 19);
+    QCOMPARE(matching.result()->size(), std::size_t(19));
+
+    // Undo and redo act on the same history as the synchronous API
+    async.undo();
+    async.redo();
+    async.updateEventFields(3, EventField::Location, EventFieldValues{.location = "Annex"});
+    QFuture<QueryPage<Event>> page = async.queryEvents(hall, EventSortKey::Date, 0, 5);
+    QCOMPARE(page.result().total, 18);
+
+    async.flush().waitForFinished();
+    QCOMPARE(async.pendingOperations(), 0);
+    const std::shared_ptr<const ControllerSnapshot> published = async.snapshot();
+    QCOMPARE(published->events->count(), std::size_t(19));
+    QCOMPARE(published->events->findById(3)->getLocation(), QString("Annex"));
+    QVERIFY(published->events->findById(3)->getVolunteerIds().contains(1));
+
+    const QString reportPath = m_tempDir + "/async_report.csv";
+    QCOMPARE(async.exportEventReport(reportPath).result(), qint64(19));
+    QFile::remove(reportPath);
+}
+
+void TestVolunteerManagement::testRemovedVolunteerIdNotInherited()
+{
+    auto volunteerRepo = std::make_unique<CSVVolunteerRepository>(m_volunteerCsvPath);
+    auto eventRepo = std::make_unique<CSVEventRepository>(m_eventCsvPath);
+    m_controller = std::make_unique<Controller>(std::move(volunteerRepo), std::move(eventRepo));
+
+    const int alice = m_controller->addVolunteer("Alice", "alice@example.com");
+    m_controller->addEvent(Event(1, "Cleanup", QDate(2024, 6, 15), "Park"));
+    m_controller->addEvent(Event(2, "Planting", QDate(2024, 6, 15), "Garden"));
+    QVERIFY(m_controller->addVolunteerToEvent(alice, 1));
+
+    m_controller->removeVolunteer(alice);
+    QVERIFY(!m_controller->findEvent(1)->getVolunteerIds().contains(alice));
+
+    // The freed ID is reused, without the old assignments or booking slots
+    const int bob = m_controller->addVolunteer("Bob", "bob@example.com");
+    QCOMPARE(bob, alice);
+    QVERIFY(!m_controller->findEvent(1)->getVolunteerIds().contains(bob));
+    QVERIFY(m_controller->addVolunteerToEvent(bob, 2)); // Not rejected as a double booking
+    QCOMPARE(m_controller->aggregates().eventsForVolunteer(bob), 1);
+
+    // Undoing Bob's add takes him off his event too; undoing the removal puts Alice back on hers
+    m_controller->undo();
+    QVERIFY(m_controller->findEvent(2)->getVolunteerIds().isEmpty());
+    m_controller->undo();
+    QCOMPARE(m_controller->findVolunteer(alice)->getName(), QString("Alice"));
+    QCOMPARE(m_controller->findEvent(1)->getVolunteerIds(), QList<int>({alice}));
+}
+
+void TestVolunteerManagement::testDoubleBookingOnDateChangeAndImport()
+{
+    auto volunteerRepo = std::make_unique<CSVVolunteerRepository>(m_volunteerCsvPath);
+    auto eventRepo = std::make_unique<CSVEventRepository>(m_eventCsvPath);
+    m_controller = std::make_unique<Controller>(std::move(volunteerRepo), std::move(eventRepo));
+
+    m_controller->addVolunteer(Volunteer(1, "Alice", "alice@example.com"));
+    m_controller->addEvent(Event(100, "Cleanup", QDate(2024, 6, 15), "Central Park"));
+    m_controller->addEvent(Event(101, "Reading", QDate(2024, 6, 16), "Library"));
+    QVERIFY(m_controller->addVolunteerToEvent(1, 100));
+    QVERIFY(m_controller->addVolunteerToEvent(1, 101));
+
+    // Moving Reading onto Cleanup's day is rejected, whole or by field
+    Event moved(101, "Reading", QDate(2024, 6, 15), "Library");
+    moved.addVolunteer(1);
+    m_controller->updateEvent(101, moved);
+    QCOMPARE(m_controller->findEvent(101)->getDate(), QDate(2024, 6, 16));
+    EventFieldValues values;
+    values.date = QDate(2024, 6, 15);
+    m_controller->updateEventFields(101, EventField::Date, values);
+    QCOMPARE(m_controller->findEvent(101)->getDate(), QDate(2024, 6, 16));
+    QVERIFY(m_controller->findBookingConflicts().empty());
+
+    // Edits that take no new slot still go through
+    values.title = "Story Time";
+    m_controller->updateEventFields(101, EventField::Title, values);
+    QCOMPARE(m_controller->findEvent(101)->getTitle(), QString("Story Time"));
+
+    // Imported rows are checked against stored events and against each other
+    Event clashesStored(200, "Food Drive", QDate(2024, 6, 15), "Library");
+    clashesStored.addVolunteer(1);
+    Event first(201, "Bake Sale", QDate(2024, 6, 20), "School");
+    first.addVolunteer(1);
+    Event clashesFirst(202, "Car Wash", QDate(2024, 6, 20), "School");
+    clashesFirst.addVolunteer(1);
+    ImportResult result = m_controller->importEvents({clashesStored, first, clashesFirst});
+    QCOMPARE(result.imported, 1);
+    QCOMPARE(result.issues.size(), 2);
+    QCOMPARE(result.issues[0].id, 200);
+    QCOMPARE(result.issues[1].id, 202);
+    QVERIFY(!m_controller->findEvent(200));
+    QVERIFY(m_controller->findEvent(201));
+    QVERIFY(!m_controller->findEvent(202));
+    QVERIFY(m_controller->findBookingConflicts().empty());
+
+    // With assigned IDs, rows sharing the caller's ID 0 are still told apart
+    Event unnumbered(0, "Fun Run", QDate(2024, 6, 21), "Park");
+    unnumbered.addVolunteer(1);
+    Event unnumberedClash(0, "Picnic", QDate(2024, 6, 21), "Park");
+    unnumberedClash.addVolunteer(1);
+    result = m_controller->importEvents({unnumbered, unnumberedClash}, ImportIds::Assign);
+    QCOMPARE(result.imported, 1);
+    QCOMPARE(result.issues.size(), 1);
+    QCOMPARE(result.issues[0].id, 0);
+    QCOMPARE(result.issues[0].message, QString("Double-books volunteers with imported events 0"));
+    QVERIFY(m_controller->findBookingConflicts().empty());
+
+    // Under the warn policy the move goes through and shows up in the report
+    m_controller->setDoubleBookingPolicy(DoubleBookingPolicy::Warn);
+    m_controller->updateEventFields(101, EventField::Date, values);
+    QCOMPARE(m_controller->findEvent(101)->getDate(), QDate(2024, 6, 15));
+    QCOMPARE(m_controller->findBookingConflicts().size(), 1);
+}
+
+void TestVolunteerManagement::testControllerShutdownWithMetricsDump()
+{
+    auto volunteerRepo = std::make_unique<CSVVolunteerRepository>(m_volunteerCsvPath);
+    auto eventRepo = std::make_unique<CSVEventRepository>(m_eventCsvPath);
+    m_controller = std::make_unique<Controller>(std::move(volunteerRepo), std::move(eventRepo));
+
+    m_controller->addVolunteer(Volunteer(1, "Alice", "alice@example.com"));
+    m_controller->addEvent(Event(100, "Cleanup", QDate(2024, 6, 15), "Central Park"));
+    m_controller->setSnapshotReads(true);
+    const QString dumpPath = m_tempDir + "/shutdown_metrics.prom";
+    m_controller->startMetricsDump(dumpPath, MetricsFormat::Prometheus, 60000);
+
+    // The dumper writes its final sample while the snapshot stores are still alive
+    m_controller.reset();
+    QFile dump(dumpPath);
+    QVERIFY(dump.open(QIODevice::ReadOnly));
+    QVERIFY(dump.readAll().contains("volunteer_memory_indexes_bytes"));
+}
+
 // ============================================================================
 // INTEGRATION TESTS
 // ============================================================================
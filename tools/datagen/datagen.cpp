@@ -0,0 +1,283 @@
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QDir>
+#include <QFile>
+#include <QDate>
+#include <QElapsedTimer>
+#include <QDebug>
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "../../Repository/IdAllocator.h"
+
+// Writes volunteers.<ext> and events.<ext> in the line format every repository reads:
+//   volunteers: id,name,contact
+//   events:     id,title,yyyy-MM-dd,location[,volunteerId...]
+// Output depends only on the options and the seed. The std:: distributions are
+// implementation-defined, so values are derived from raw mt19937_64 output instead.
+
+namespace {
+
+const char* const kFirstNames[] = {"Alex", "Sam", "Jordan", "Taylor", "Morgan", "Casey", "Riley", "Jamie",
+                                   "Avery", "Quinn", "Harper", "Rowan", "Emerson", "Finley", "Hayden", "Kai"};
+const char* const kLastNames[] = {"Smith", "Garcia", "Chen", "Novak", "Okafor", "Silva", "Kowalski", "Haddad",
+                                  "Nguyen", "Moreau", "Rossi", "Tanaka", "Ivanova", "Murphy", "Larsen", "Patel"};
+const char* const kActivities[] = {"Cleanup", "Food Drive", "Fundraiser", "Workshop", "Tree Planting",
+                                   "Book Sale", "Charity Run", "Clothing Drive", "Blood Drive", "Tutoring"};
+const char* const kPlaces[] = {"Park", "Library", "Community Center", "Riverside", "Town Hall", "Harbor",
+                               "Market", "Stadium", "School", "Museum", "Church Hall", "Shelter"};
+const char* const kAreas[] = {"North", "South", "East", "West", "Central", "Old Town", "Uptown", "Lakeside"};
+
+template <typename T, std::size_t N>
+constexpr std::size_t countOf(const T (&)[N]) { return N; }
+
+class Random {
+public:
+    explicit Random(quint64 seed) : m_engine(seed) {}
+
+    // Uniform in [0, n); the modulo bias is negligible for the small n used here
+    quint64 below(quint64 n) { return m_engine() % n; }
+    // Uniform in [0, 1)
+    double unit() { return static_cast<double>(m_engine() >> 11) * 0x1.0p-53; }
+
+private:
+    std::mt19937_64 m_engine;
+};
+
+// Zipf(s) over n ranks: rank 0 is the most frequent
+class ZipfSampler {
+public:
+    ZipfSampler(int n, double s) : m_cdf(static_cast<std::size_t>(n)) {
+        double sum = 0.0;
+        for (int k = 0; k < n; ++k) {
+            sum += 1.0 / std::pow(k + 1, s);
+            m_cdf[static_cast<std::size_t>(k)] = sum;
+        }
+        for (double& c : m_cdf) {
+            c /= sum;
+        }
+    }
+
+    int sample(Random& random) const {
+        auto it = std::upper_bound(m_cdf.begin(), m_cdf.end(), random.unit());
+        return static_cast<int>(std::min<std::ptrdiff_t>(it - m_cdf.begin(), static_cast<std::ptrdiff_t>(m_cdf.size()) - 1));
+    }
+
+private:
+    std::vector<double> m_cdf;
+};
+
+// Appends into a large in-memory block and hands it to the file in one write per block
+class BufferedWriter {
+public:
+    explicit BufferedWriter(const QString& filename) : m_file(filename) {
+        m_buffer.reserve(kBlockSize + 4096);
+    }
+    ~BufferedWriter() { close(); }
+
+    bool open() { return m_file.open(QIODevice::WriteOnly | QIODevice::Truncate); }
+
+    BufferedWriter& operator<<(const QByteArray& text) { m_buffer.append(text); return flushIfFull(); }
+    BufferedWriter& operator<<(const char* text) { m_buffer.append(text); return flushIfFull(); }
+    BufferedWriter& operator<<(char c) { m_buffer.append(c); return flushIfFull(); }
+    BufferedWriter& operator<<(int value) {
+        char digits[16];
+        auto result = std::to_chars(digits, digits + sizeof(digits), value);
+        m_buffer.append(digits, static_cast<qsizetype>(result.ptr - digits));
+        return flushIfFull();
+    }
+
+    bool close() {
+        if (!m_file.isOpen()) {
+            return !m_failed;
+        }
+        flush();
+        m_file.close();
+        return !m_failed;
+    }
+
+private:
+    static constexpr qsizetype kBlockSize = 4 * 1024 * 1024;
+
+    BufferedWriter& flushIfFull() {
+        if (m_buffer.size() >= kBlockSize) {
+            flush();
+        }
+        return *this;
+    }
+
+    void flush() {
+        if (!m_buffer.isEmpty() && m_file.write(m_buffer) != m_buffer.size()) {
+            m_failed = true;
+        }
+        m_buffer.clear();
+    }
+
+    QFile m_file;
+    QByteArray m_buffer;
+    bool m_failed = false;
+};
+
+struct Options {
+    int volunteers = 100000;
+    int events = 1000000;
+    quint64 seed = 42;
+    QDate startDate = QDate(2020, 1, 1);
+    int years = 5;
+    int locations = 500;
+    double locationSkew = 1.1;   // Zipf exponent for event locations
+    double assignmentAlpha = 2.2; // Power-law exponent for volunteers per event
+    int maxVolunteersPerEvent = 200;
+};
+
+// The repository sidecar, so the generated IDs are not handed out again
+void writeIdSidecar(const QString& filename, int rows) {
+    IdAllocator ids;
+    ids.reserve(rows);
+    ids.save(filename + ".ids");
+}
+
+bool writeVolunteers(const QString& filename, const Options& options, Random& random) {
+    BufferedWriter out(filename);
+    if (!out.open()) {
+        qWarning() << "Could not open volunteer file for writing:" << filename;
+        return false;
+    }
+    for (int id = 1; id <= options.volunteers; ++id) {
+        const char* first = kFirstNames[random.below(countOf(kFirstNames))];
+        const char* last = kLastNames[random.below(countOf(kLastNames))];
+        out << id << ',' << first << ' ' << last << ',' << QByteArray(first).toLower() << '.'
+            << QByteArray(last).toLower() << id << "@example.org\n";
+    }
+    if (!out.close()) {
+        qWarning() << "Failed writing" << filename;
+        return false;
+    }
+    writeIdSidecar(filename, options.volunteers);
+    return true;
+}
+
+bool writeEvents(const QString& filename, const Options& options, Random& random) {
+    BufferedWriter out(filename);
+    if (!out.open()) {
+        qWarning() << "Could not open event file for writing:" << filename;
+        return false;
+    }
+
+    // Location names are fixed per rank so the skew is stable for a given seed
+    std::vector<QByteArray> locations;
+    locations.reserve(static_cast<std::size_t>(options.locations));
+    for (int i = 0; i < options.locations; ++i) {
+        QByteArray name = QByteArray(kAreas[i % countOf(kAreas)]) + ' ' + kPlaces[(i / countOf(kAreas)) % countOf(kPlaces)];
+        if (i >= static_cast<int>(countOf(kAreas) * countOf(kPlaces))) {
+            name += ' ' + QByteArray::number(i / static_cast<int>(countOf(kAreas) * countOf(kPlaces)) + 1);
+        }
+        locations.push_back(name);
+    }
+    const ZipfSampler locationSampler(options.locations, options.locationSkew);
+    const qint64 dayRange = std::max<qint64>(1, options.startDate.daysTo(options.startDate.addYears(options.years)));
+    const int maxPerEvent = std::min(options.maxVolunteersPerEvent, options.volunteers);
+
+    std::vector<int> assigned;
+    for (int id = 1; id <= options.events; ++id) {
+        const QDate date = options.startDate.addDays(static_cast<qint64>(random.below(static_cast<quint64>(dayRange))));
+        out << id << ',' << kActivities[random.below(countOf(kActivities))] << ' ' << id << ','
+            << date.toString(Qt::ISODate).toLatin1() << ',' << locations[static_cast<std::size_t>(locationSampler.sample(random))];
+
+        // Discrete Pareto: most events get a handful of volunteers, a few get very many
+        const double u = random.unit();
+        int count = static_cast<int>(std::floor(std::pow(1.0 - u, -1.0 / (options.assignmentAlpha - 1.0)))) - 1;
+        count = std::clamp(count, 0, maxPerEvent);
+        assigned.clear();
+        while (static_cast<int>(assigned.size()) < count) {
+            int volunteerId = static_cast<int>(random.below(static_cast<quint64>(options.volunteers))) + 1;
+            if (std::find(assigned.begin(), assigned.end(), volunteerId) == assigned.end()) {
+                assigned.push_back(volunteerId);
+                out << ',' << volunteerId;
+            }
+        }
+        out << '\n';
+    }
+    if (!out.close()) {
+        qWarning() << "Failed writing" << filename;
+        return false;
+    }
+    writeIdSidecar(filename, options.events);
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("datagen");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Generates deterministic volunteer and event datasets.");
+    parser.addHelpOption();
+    QCommandLineOption volunteersOption("volunteers", "Number of volunteers.", "rows", "100000");
+    QCommandLineOption eventsOption("events", "Number of events.", "rows", "1000000");
+    QCommandLineOption seedOption("seed", "Random seed; equal seeds give identical files.", "seed", "42");
+    QCommandLineOption formatOption("format", "csv, json or all.", "format", "csv");
+    QCommandLineOption outputOption({"o", "output"}, "Output directory.", "dir", ".");
+    QCommandLineOption startOption("start", "First event date (yyyy-MM-dd).", "date", "2020-01-01");
+    QCommandLineOption yearsOption("years", "Years the event dates span.", "years", "5");
+    QCommandLineOption locationsOption("locations", "Number of distinct locations.", "count", "500");
+    QCommandLineOption maxPerEventOption("max-per-event", "Upper bound on volunteers per event.", "count", "200");
+    parser.addOptions({volunteersOption, eventsOption, seedOption, formatOption, outputOption, startOption,
+                       yearsOption, locationsOption, maxPerEventOption});
+    parser.process(app);
+
+    Options options;
+    options.volunteers = parser.value(volunteersOption).toInt();
+    options.events = parser.value(eventsOption).toInt();
+    options.seed = parser.value(seedOption).toULongLong();
+    options.startDate = QDate::fromString(parser.value(startOption), Qt::ISODate);
+    options.years = parser.value(yearsOption).toInt();
+    options.locations = parser.value(locationsOption).toInt();
+    options.maxVolunteersPerEvent = parser.value(maxPerEventOption).toInt();
+    if (options.volunteers <= 0 || options.events < 0 || !options.startDate.isValid() || options.years <= 0
+        || options.locations <= 0 || options.maxVolunteersPerEvent < 0) {
+        qWarning() << "Invalid generator options.";
+        return 1;
+    }
+
+    // Both repository families read the same line format; only the file names differ
+    QStringList extensions;
+    const QString format = parser.value(formatOption).toLower();
+    if (format == "csv" || format == "all") {
+        extensions << "csv";
+    }
+    if (format == "json" || format == "all") {
+        extensions << "json";
+    }
+    if (extensions.isEmpty()) {
+        qWarning() << "Unknown format:" << format;
+        return 1;
+    }
+
+    QDir dir(parser.value(outputOption));
+    if (!dir.mkpath(".")) {
+        qWarning() << "Could not create output directory:" << dir.path();
+        return 1;
+    }
+
+    for (const QString& extension : extensions) {
+        QElapsedTimer timer;
+        timer.start();
+        // Each file gets its own stream so the event file does not depend on the volunteer count draws
+        Random volunteerRandom(options.seed);
+        Random eventRandom(options.seed ^ 0x9E3779B97F4A7C15ULL);
+        const QString volunteerFile = dir.filePath("volunteers." + extension);
+        const QString eventFile = dir.filePath("events." + extension);
+        if (!writeVolunteers(volunteerFile, options, volunteerRandom) || !writeEvents(eventFile, options, eventRandom)) {
+            return 1;
+        }
+        qInfo().noquote() << QString("Wrote %1 volunteers and %2 events as %3 in %4 ms")
+                                 .arg(options.volunteers).arg(options.events).arg(extension).arg(timer.elapsed());
+    }
+    return 0;
+}
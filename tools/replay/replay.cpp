@@ -0,0 +1,122 @@
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+#include <QDebug>
+#include <cstdio>
+#include <memory>
+
+#include "../../Controller/Controller.h"
+#include "../../Repository/CSV/CSVVolunteerRepository.h"
+#include "../../Repository/CSV/CSVEventRepository.h"
+#include "../../Repository/JSON/JSONVolunteerRepository.h"
+#include "../../Repository/JSON/JSONEventRepository.h"
+#include "../../core/Replay/OperationReplayer.h"
+
+// Replays an operation log recorded with Controller::startRecording (or VOLUNTEER_RECORD_FILE)
+// against a chosen repository backend and reports throughput and per-operation latency.
+// The backend works on copies in a temporary directory, so the starting dataset is never modified.
+
+namespace {
+
+// Repositories log every operation; keep warnings, drop the per-row chatter
+void quietMessageHandler(QtMsgType type, const QMessageLogContext&, const QString& message) {
+    if (type == QtDebugMsg || type == QtInfoMsg) {
+        return;
+    }
+    std::fprintf(stderr, "%s\n", qPrintable(message));
+}
+
+bool copyIfExists(const QString& from, const QString& to) {
+    if (!QFile::exists(from)) {
+        return true;
+    }
+    return QFile::copy(from, to);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("replay");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Replays a recorded operation log as fast as possible.");
+    parser.addHelpOption();
+    parser.addPositionalArgument("log", "Operation log to replay.");
+    QCommandLineOption backendOption("backend", "Repository backend: csv or json.", "backend", "csv");
+    QCommandLineOption dataOption("data", "Start from volunteers.<ext> and events.<ext> in this directory "
+                                          "(default: empty repositories).", "dir");
+    QCommandLineOption jsonOption("json", "Also write the report as JSON to this file.", "path");
+    parser.addOptions({backendOption, dataOption, jsonOption});
+    parser.process(app);
+
+    if (parser.positionalArguments().size() != 1) {
+        parser.showHelp(1);
+    }
+    qInstallMessageHandler(quietMessageHandler);
+
+    std::vector<RecordedOperation> operations;
+    if (!OperationLog::read(parser.positionalArguments().first(), operations)) {
+        return 1;
+    }
+
+    const QString backend = parser.value(backendOption).toLower();
+    if (backend != "csv" && backend != "json") {
+        qWarning() << "Unknown backend:" << backend;
+        return 1;
+    }
+
+    QTemporaryDir workDir;
+    if (!workDir.isValid()) {
+        qWarning() << "Could not create a working directory.";
+        return 1;
+    }
+    const QString volunteerFile = workDir.filePath("volunteers." + backend);
+    const QString eventFile = workDir.filePath("events." + backend);
+    if (parser.isSet(dataOption)) {
+        const QDir data(parser.value(dataOption));
+        for (const QString& name : {QString("volunteers.") + backend, QString("events.") + backend}) {
+            if (!copyIfExists(data.filePath(name), workDir.filePath(name))
+                || !copyIfExists(data.filePath(name + ".ids"), workDir.filePath(name + ".ids"))) {
+                qWarning() << "Could not copy" << name << "from" << data.path();
+                return 1;
+            }
+        }
+    }
+
+    std::unique_ptr<Controller> controller;
+    if (backend == "csv") {
+        controller = std::make_unique<Controller>(std::make_unique<CSVVolunteerRepository>(volunteerFile),
+                                                  std::make_unique<CSVEventRepository>(eventFile));
+    } else {
+        controller = std::make_unique<Controller>(std::make_unique<JSONVolunteerRepository>(volunteerFile),
+                                                  std::make_unique<JSONEventRepository>(eventFile));
+    }
+
+    const ReplayReport report = OperationReplayer::replay(*controller, operations);
+
+    std::printf("%-20s %10s %12s %12s %12s %12s\n", "operation", "count", "mean us", "p50 us", "p99 us", "max us");
+    for (int i = 0; i < kOperationTypeCount; ++i) {
+        const HistogramSnapshot& h = report.latency[static_cast<std::size_t>(i)];
+        if (h.count == 0) {
+            continue;
+        }
+        std::printf("%-20s %10llu %12.1f %12.1f %12.1f %12.1f\n", operationName(static_cast<OperationType>(i)),
+                    static_cast<unsigned long long>(h.count), h.meanNs() / 1e3, h.p50Ns / 1e3, h.p99Ns / 1e3,
+                    h.maxNs / 1e3);
+    }
+    std::printf("\n%lld operations in %.1f ms on the %s backend: %.0f ops/s\n", static_cast<long long>(report.operations),
+                report.elapsedNs / 1e6, qPrintable(backend), report.operationsPerSecond());
+
+    if (parser.isSet(jsonOption)) {
+        QFile file(parser.value(jsonOption));
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+            qWarning() << "Could not open report file for writing:" << file.fileName();
+            return 1;
+        }
+        file.write(report.toJson());
+    }
+    return 0;
+}
@@ -0,0 +1,107 @@
+#include "EventListModel.h"
+
+EventListModel::EventListModel(Controller* controller, QObject* parent)
+    : QAbstractListModel(parent), m_controller(controller) {
+    m_rowCount = m_controller->eventCount();
+
+    ChangeNotifier* notifier = m_controller->changeNotifier();
+    connect(notifier, &ChangeNotifier::eventAdded, this, &EventListModel::onEventAdded);
+    connect(notifier, &ChangeNotifier::eventRemoved, this, &EventListModel::onEventRemoved);
+    connect(notifier, &ChangeNotifier::eventUpdated, this, &EventListModel::onEventUpdated);
+}
+
+int EventListModel::rowCount(const QModelIndex& parent) const {
+    return parent.isValid() ? 0 : m_rowCount;
+}
+
+QVariant EventListModel::data(const QModelIndex& index, int role) const {
+    if (!index.isValid() || index.row() >= m_rowCount) {
+        return QVariant();
+    }
+    if (role == IdRole) {
+        return m_filtered ? m_filteredIds[static_cast<std::size_t>(index.row())] : m_controller->eventAt(index.row()).getId();
+    }
+    if (role != Qt::DisplayRole) {
+        return QVariant();
+    }
+    const Event* event = eventForRow(index.row());
+    return event ? QVariant(label(*event, m_showLocation)) : QVariant();
+}
+
+void EventListModel::setFilteredIds(std::vector<int> ids, bool showLocation) {
+    beginResetModel();
+    m_filteredIds = std::move(ids);
+    m_filtered = true;
+    m_showLocation = showLocation;
+    m_rowCount = static_cast<int>(m_filteredIds.size());
+    endResetModel();
+}
+
+void EventListModel::clearFilter() {
+    beginResetModel();
+    m_filteredIds.clear();
+    m_filteredIds.shrink_to_fit();
+    m_filtered = false;
+    m_showLocation = false;
+    m_rowCount = m_controller->eventCount();
+    endResetModel();
+}
+
+QString EventListModel::label(const Event& event, bool showLocation) {
+    QString text = QString::number(event.getId()) + " - " + event.getTitle() + " (" + event.getDate().toString("yyyy-MM-dd");
+    if (showLocation) {
+        text += " - " + event.getLocation();
+    }
+    return text + ")";
+}
+
+const Event* EventListModel::eventForRow(int row) const {
+    if (row < 0 || row >= m_rowCount) {
+        return nullptr;
+    }
+    if (!m_filtered) {
+        return &m_controller->eventAt(row);
+    }
+    return m_controller->findEvent(m_filteredIds[static_cast<std::size_t>(row)]);
+}
+
+void EventListModel::onEventAdded(const Event& event) {
+    Q_UNUSED(event);
+    if (m_filtered) {
+        clearFilter(); // Any operation returns to the full list, as repopulating used to
+        return;
+    }
+    beginInsertRows(QModelIndex(), m_rowCount, m_rowCount);
+    ++m_rowCount;
+    endInsertRows();
+}
+
+void EventListModel::onEventRemoved(const Event& event) {
+    Q_UNUSED(event);
+    if (m_filtered) {
+        clearFilter();
+        return;
+    }
+    beginResetModel();
+    m_rowCount = m_controller->eventCount();
+    endResetModel();
+}
+
+void EventListModel::onEventUpdated(const Event& oldEvent, const Event& newEvent) {
+    // Assignment changes leave the label as it is
+    if (oldEvent.getTitle() == newEvent.getTitle() && oldEvent.getDate() == newEvent.getDate()
+        && oldEvent.getLocation() == newEvent.getLocation()) {
+        return;
+    }
+    if (m_filtered) {
+        // Locating the row would need a scan of the subset; refreshing the visible rows is cheaper
+        if (m_rowCount > 0) {
+            emit dataChanged(index(0), index(m_rowCount - 1), {Qt::DisplayRole});
+        }
+        return;
+    }
+    int row = m_controller->eventRow(newEvent.getId());
+    if (row >= 0 && row < m_rowCount) {
+        emit dataChanged(index(row), index(row), {Qt::DisplayRole});
+    }
+}
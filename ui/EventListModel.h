@@ -0,0 +1,42 @@
+#ifndef EVENTLISTMODEL_H
+#define EVENTLISTMODEL_H
+
+#include <QAbstractListModel>
+#include <vector>
+#include "../Controller/Controller.h"
+#include "ItemRoles.h"
+
+// Events in storage order, read from the repository on demand, or a filtered
+// subset held as IDs only. Display strings are built per visible row.
+class EventListModel : public QAbstractListModel {
+    Q_OBJECT
+
+public:
+    explicit EventListModel(Controller* controller, QObject* parent = nullptr);
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+    // Shows only these events; adding or removing an event drops the filter again
+    void setFilteredIds(std::vector<int> ids, bool showLocation = false);
+    void clearFilter();
+    bool isFiltered() const { return m_filtered; }
+
+    static QString label(const Event& event, bool showLocation = false);
+
+private slots:
+    void onEventAdded(const Event& event);
+    void onEventRemoved(const Event& event);
+    void onEventUpdated(const Event& oldEvent, const Event& newEvent);
+
+private:
+    const Event* eventForRow(int row) const;
+
+    Controller* m_controller;
+    int m_rowCount = 0;
+    bool m_filtered = false;
+    bool m_showLocation = false;
+    std::vector<int> m_filteredIds;
+};
+
+#endif // EVENTLISTMODEL_H
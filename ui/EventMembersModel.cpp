@@ -0,0 +1,73 @@
+#include "EventMembersModel.h"
+#include "VolunteerListModel.h"
+
+EventMembersModel::EventMembersModel(Controller* controller, QObject* parent)
+    : QAbstractListModel(parent), m_controller(controller) {
+    ChangeNotifier* notifier = m_controller->changeNotifier();
+    connect(notifier, &ChangeNotifier::eventRemoved, this, &EventMembersModel::onEventRemoved);
+    connect(notifier, &ChangeNotifier::volunteerAssigned, this, &EventMembersModel::onAssignmentChanged);
+    connect(notifier, &ChangeNotifier::volunteerUnassigned, this, &EventMembersModel::onAssignmentChanged);
+    connect(notifier, &ChangeNotifier::volunteerUpdated, this, &EventMembersModel::onVolunteerUpdated);
+    connect(notifier, &ChangeNotifier::volunteerRemoved, this, &EventMembersModel::onVolunteerRemoved);
+}
+
+int EventMembersModel::rowCount(const QModelIndex& parent) const {
+    return parent.isValid() ? 0 : static_cast<int>(m_volunteerIds.size());
+}
+
+QVariant EventMembersModel::data(const QModelIndex& index, int role) const {
+    if (!index.isValid() || index.row() >= m_volunteerIds.size()) {
+        return QVariant();
+    }
+    const int volunteerId = m_volunteerIds[index.row()];
+    if (role == IdRole) {
+        return volunteerId;
+    }
+    if (role != Qt::DisplayRole) {
+        return QVariant();
+    }
+    const Volunteer* volunteer = m_controller->findVolunteer(volunteerId);
+    return volunteer ? QVariant(VolunteerListModel::label(*volunteer)) : QVariant();
+}
+
+void EventMembersModel::setEvent(int eventId) {
+    beginResetModel();
+    m_eventId = eventId;
+    m_volunteerIds.clear();
+    if (const Event* event = m_controller->findEvent(eventId)) {
+        // Only the k assigned volunteers are looked up; missing ones are left out, as before
+        for (int volunteerId : event->getVolunteerIds()) {
+            if (m_controller->findVolunteer(volunteerId)) {
+                m_volunteerIds.append(volunteerId);
+            }
+        }
+    }
+    endResetModel();
+}
+
+void EventMembersModel::onEventRemoved(const Event& event) {
+    if (event.getId() == m_eventId) {
+        setEvent(-1);
+    }
+}
+
+void EventMembersModel::onAssignmentChanged(int eventId, int volunteerId) {
+    Q_UNUSED(volunteerId);
+    if (eventId == m_eventId) {
+        setEvent(eventId); // Re-reads only this event's k members
+    }
+}
+
+void EventMembersModel::onVolunteerUpdated(const Volunteer& oldVolunteer, const Volunteer& newVolunteer) {
+    Q_UNUSED(oldVolunteer);
+    int row = static_cast<int>(m_volunteerIds.indexOf(newVolunteer.getId()));
+    if (row >= 0) {
+        emit dataChanged(index(row), index(row), {Qt::DisplayRole});
+    }
+}
+
+void EventMembersModel::onVolunteerRemoved(const Volunteer& volunteer) {
+    if (m_volunteerIds.contains(volunteer.getId())) {
+        setEvent(m_eventId);
+    }
+}
@@ -0,0 +1,36 @@
+#ifndef EVENTMEMBERSMODEL_H
+#define EVENTMEMBERSMODEL_H
+
+#include <QAbstractListModel>
+#include <QList>
+#include "../Controller/Controller.h"
+#include "ItemRoles.h"
+
+// Volunteers assigned to one event. Holds only their IDs; names are resolved
+// through the volunteer index when a row is displayed.
+class EventMembersModel : public QAbstractListModel {
+    Q_OBJECT
+
+public:
+    explicit EventMembersModel(Controller* controller, QObject* parent = nullptr);
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+    // Shows the members of this event; -1 clears the list
+    void setEvent(int eventId);
+    int eventId() const { return m_eventId; }
+
+private slots:
+    void onEventRemoved(const Event& event);
+    void onAssignmentChanged(int eventId, int volunteerId);
+    void onVolunteerUpdated(const Volunteer& oldVolunteer, const Volunteer& newVolunteer);
+    void onVolunteerRemoved(const Volunteer& volunteer);
+
+private:
+    Controller* m_controller;
+    int m_eventId = -1;
+    QList<int> m_volunteerIds;
+};
+
+#endif // EVENTMEMBERSMODEL_H
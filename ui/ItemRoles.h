@@ -0,0 +1,11 @@
+#ifndef ITEMROLES_H
+#define ITEMROLES_H
+
+#include <Qt>
+
+// Custom data roles shared by the list models
+enum ItemRole {
+    IdRole = Qt::UserRole + 1 // The entity ID behind a row, so views never parse display text
+};
+
+#endif // ITEMROLES_H
@@ -0,0 +1,58 @@
+#include "VolunteerListModel.h"
+
+VolunteerListModel::VolunteerListModel(Controller* controller, QObject* parent)
+    : QAbstractListModel(parent), m_controller(controller) {
+    m_rowCount = m_controller->volunteerCount();
+
+    ChangeNotifier* notifier = m_controller->changeNotifier();
+    connect(notifier, &ChangeNotifier::volunteerAdded, this, &VolunteerListModel::onVolunteerAdded);
+    connect(notifier, &ChangeNotifier::volunteerRemoved, this, &VolunteerListModel::onVolunteerRemoved);
+    connect(notifier, &ChangeNotifier::volunteerUpdated, this, &VolunteerListModel::onVolunteerUpdated);
+}
+
+int VolunteerListModel::rowCount(const QModelIndex& parent) const {
+    return parent.isValid() ? 0 : m_rowCount;
+}
+
+QVariant VolunteerListModel::data(const QModelIndex& index, int role) const {
+    if (!index.isValid() || index.row() >= m_rowCount) {
+        return QVariant();
+    }
+    const Volunteer& volunteer = m_controller->volunteerAt(index.row());
+    switch (role) {
+    case Qt::DisplayRole:
+        return label(volunteer);
+    case IdRole:
+        return volunteer.getId();
+    default:
+        return QVariant();
+    }
+}
+
+QString VolunteerListModel::label(const Volunteer& volunteer) {
+    return QString::number(volunteer.getId()) + " - " + volunteer.getName();
+}
+
+void VolunteerListModel::onVolunteerAdded(const Volunteer& volunteer) {
+    Q_UNUSED(volunteer);
+    // Repositories append, so a new volunteer is always the last row
+    beginInsertRows(QModelIndex(), m_rowCount, m_rowCount);
+    ++m_rowCount;
+    endInsertRows();
+}
+
+void VolunteerListModel::onVolunteerRemoved(const Volunteer& volunteer) {
+    Q_UNUSED(volunteer);
+    // The row it occupied is gone by the time the signal arrives; a reset re-reads only visible rows
+    beginResetModel();
+    m_rowCount = m_controller->volunteerCount();
+    endResetModel();
+}
+
+void VolunteerListModel::onVolunteerUpdated(const Volunteer& oldVolunteer, const Volunteer& newVolunteer) {
+    Q_UNUSED(oldVolunteer);
+    int row = m_controller->volunteerRow(newVolunteer.getId());
+    if (row >= 0 && row < m_rowCount) {
+        emit dataChanged(index(row), index(row), {Qt::DisplayRole});
+    }
+}
@@ -0,0 +1,31 @@
+#ifndef VOLUNTEERLISTMODEL_H
+#define VOLUNTEERLISTMODEL_H
+
+#include <QAbstractListModel>
+#include "../Controller/Controller.h"
+#include "ItemRoles.h"
+
+// Volunteers in storage order, read from the repository on demand.
+// Only rows the view asks for are formatted; nothing is copied up front.
+class VolunteerListModel : public QAbstractListModel {
+    Q_OBJECT
+
+public:
+    explicit VolunteerListModel(Controller* controller, QObject* parent = nullptr);
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+    static QString label(const Volunteer& volunteer);
+
+private slots:
+    void onVolunteerAdded(const Volunteer& volunteer);
+    void onVolunteerRemoved(const Volunteer& volunteer);
+    void onVolunteerUpdated(const Volunteer& oldVolunteer, const Volunteer& newVolunteer);
+
+private:
+    Controller* m_controller;
+    int m_rowCount = 0; // Rows the view has been told about
+};
+
+#endif // VOLUNTEERLISTMODEL_H
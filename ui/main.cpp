@@ -9,48 +9,96 @@
 #include "../Repository/CSV/CSVEventRepository.h"
 #include "../Repository/JSON/JSONVolunteerRepository.h"
 #include "../Repository/JSON/JSONEventRepository.h"
+#include "../core/Trace/Trace.h"
 #include "mainwindow.h"
 #include <QDir>
+#include <QElapsedTimer>
+#include <QFutureWatcher>
+#include <QtConcurrent/QtConcurrent>
+#include <utility>
 
 int main(int argc, char *argv[]) {
     // Initialize QApplication for GUI applications
     QApplication a(argc, argv);
 
     qDebug() << "Starting Volunteer Management Application (GUI)...";
+    QElapsedTimer startupTimer;
+    startupTimer.start();
 
-    // Define filenames for the CSV repositories and create instances of the CSV repositories
+    // Set VOLUNTEER_TRACE_FILE to trace from startup and write the spans there on exit
+    const QString traceFile = qEnvironmentVariable("VOLUNTEER_TRACE_FILE");
+    if (!traceFile.isEmpty()) {
+        Tracer::setEnabled(true);
+    }
+
+    // Define filenames for the CSV repositories
     QString volunteerCsvFile = "volunteers.csv";
     QString eventCsvFile = "events.csv";
-    auto volunteerRepo = std::make_unique<CSVVolunteerRepository>(volunteerCsvFile);
-    auto eventRepo = std::make_unique<CSVEventRepository>(eventCsvFile);
 
     // QString volunteerJsonFile = "volunteers.json";
     // QString eventJsonFile = "events.json";
-    // auto volunteerRepo = std::make_unique<JSONVolunteerRepository>(volunteerJsonFile);
-    // auto eventRepo = std::make_unique<JSONEventRepository>(eventJsonFile);
-
+    // (swap in JSONVolunteerRepository / JSONEventRepository below to use them)
 
-    // Create the Controller, passing in the repositories
-    // The Controller takes ownership of the repository unique_ptr's
-    // We'll keep the controller on the stack here, or you could manage it with a smart pointer
-    // if MainWindow takes ownership or a shared pointer.
-    // For simplicity, assuming MainWindow takes a reference or a raw pointer to a stack-allocated controller.
-    Controller controller(std::move(volunteerRepo), std::move(eventRepo));
+    // Declared before the window so it outlives it
+    std::unique_ptr<Controller> controller;
 
-    qDebug() << "Controller and repositories initialized.";
-
-    // Create and show the MainWindow
-    // This assumes your MainWindow constructor can take a Controller reference or pointer.
-    // Adjust if your MainWindow constructor is different.
-    // Example: MainWindow mainWindow(&controller); or MainWindow mainWindow(controller);
-    MainWindow mainWindow(&controller); // Pass controller by pointer
+    // Show the window straight away; it stays disabled, with a busy indicator, until loading completes
+    MainWindow mainWindow;
     mainWindow.setWindowTitle("Volunteer and Event Management"); // Optional: Set a window title
+    QObject::connect(&mainWindow, &MainWindow::firstPainted, [&startupTimer]() {
+        qDebug() << "Time to first paint:" << startupTimer.elapsed() << "ms";
+    });
     mainWindow.show();
 
-    qDebug() << "MainWindow shown. Starting event loop...";
+    // Load both repositories in parallel: events on a second worker, volunteers on this one
+    using LoadedRepositories = std::pair<BaseRepository<Volunteer>*, BaseRepository<Event>*>;
+    QFuture<LoadedRepositories> loading = QtConcurrent::run([volunteerCsvFile, eventCsvFile]() {
+        QFuture<BaseRepository<Event>*> events = QtConcurrent::run([eventCsvFile]() -> BaseRepository<Event>* {
+            return new CSVEventRepository(eventCsvFile);
+        });
+        BaseRepository<Volunteer>* volunteers = new CSVVolunteerRepository(volunteerCsvFile);
+        return LoadedRepositories(volunteers, events.result());
+    });
 
+    // The controller registers its observers and the window builds its models on the GUI thread
+    QFutureWatcher<LoadedRepositories> loadingWatcher;
+    QObject::connect(&loadingWatcher, &QFutureWatcherBase::finished, [&]() {
+        LoadedRepositories loaded = loadingWatcher.result();
+        controller = std::make_unique<Controller>(std::unique_ptr<BaseRepository<Volunteer>>(loaded.first),
+                                                  std::unique_ptr<BaseRepository<Event>>(loaded.second));
+        qDebug() << "Controller and repositories initialized.";
+        mainWindow.setController(controller.get());
+        // Optional operation log for replaying this session against other backends
+        const QString recordFile = qEnvironmentVariable("VOLUNTEER_RECORD_FILE");
+        if (!recordFile.isEmpty()) {
+            controller->startRecording(recordFile);
+        }
+        // Optional periodic metrics dump: JSON for a *.json file, Prometheus text otherwise
+        const QString metricsFile = qEnvironmentVariable("VOLUNTEER_METRICS_FILE");
+        if (!metricsFile.isEmpty()) {
+            controller->startMetricsDump(metricsFile,
+                                         metricsFile.endsWith(".json") ? MetricsFormat::Json : MetricsFormat::Prometheus,
+                                         10000);
+        }
+        qDebug() << "Time to interactive:" << startupTimer.elapsed() << "ms";
+    });
+    loadingWatcher.setFuture(loading);
 
+    qDebug() << "MainWindow shown. Starting event loop...";
 
     // Start the Qt event loop. This is essential for GUI applications.
-    return a.exec();
+    int exitCode = a.exec();
+
+    if (!traceFile.isEmpty()) {
+        Tracer::exportChromeTrace(traceFile);
+    }
+
+    // Closed before loading finished: nothing took ownership of the repositories
+    if (!controller) {
+        loading.waitForFinished();
+        LoadedRepositories loaded = loading.result();
+        delete loaded.first;
+        delete loaded.second;
+    }
+    return exitCode;
 }
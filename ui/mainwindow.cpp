@@ -2,23 +2,26 @@
 #include "mainwindow.h"
 #include "ui_mainwindow.h"
 #include <QMessageBox>
-#include <QListWidgetItem>
+#include "VolunteerListModel.h"
+#include "EventListModel.h"
+#include "EventMembersModel.h"
 #include <QDate>
 #include <QDebug>
+#include <QtConcurrent/QtConcurrent>
+#include <QProgressBar>
+#include <QFileDialog>
+#include "../core/Trace/Trace.h"
 
 MainWindow::MainWindow(Controller* controller, QWidget *parent)
     : QMainWindow(parent)
     , ui(new Ui::MainWindow)
-    , m_controller(controller)
+    , m_controller(nullptr)
+    , m_volunteerModel(nullptr)
+    , m_eventModel(nullptr)
+    , m_eventMembersModel(nullptr)
 {
     ui->setupUi(this);
 
-    if (!m_controller) {
-        qWarning() << "MainWindow initialized with a null controller pointer!";
-    } else {
-        qDebug() << "MainWindow initialized with controller.";
-    }
-
     connect(ui->addVolunteerButton, &QPushButton::clicked, this, &MainWindow::addVolunteer);
     connect(ui->removeVolunteerButton, &QPushButton::clicked, this, &MainWindow::removeSelectedVolunteer);
     connect(ui->updateVolunteerButton, &QPushButton::clicked, this, &MainWindow::updateSelectedVolunteer);
@@ -29,21 +32,90 @@ MainWindow::MainWindow(Controller* controller, QWidget *parent)
     connect(ui->redoButton, &QPushButton::clicked, this, &MainWindow::redo);
     connect(ui->assignVolunteerToEventButton, &QPushButton::clicked, this, &MainWindow::assignVolunteerToEvent);
     connect(ui->removeVolunteerFromEventButton, &QPushButton::clicked, this, &MainWindow::removeVolunteerFromEvent);
-    connect(ui->eventListWidget, &QListWidget::itemSelectionChanged, this, &MainWindow::updateVolunteersInEventList);
 
     connect(ui->filterEventsByDateButton, &QPushButton::clicked, this, &MainWindow::filterEventsByDate);
     connect(ui->filterEventsByLocationButton, &QPushButton::clicked, this, &MainWindow::filterEventsByLocation);
 
-    populateVolunteerList();
-    populateEventList();
+    m_filterDebounce.setSingleShot(true);
+    m_filterDebounce.setInterval(250);
+    connect(&m_filterDebounce, &QTimer::timeout, this, &MainWindow::runEventFilter);
+    connect(ui->eventDateFilterLineEdit, &QLineEdit::textChanged, &m_filterDebounce, qOverload<>(&QTimer::start));
+    connect(ui->eventLocationFilterLineEdit, &QLineEdit::textChanged, &m_filterDebounce, qOverload<>(&QTimer::start));
+    connect(&m_filterWatcher, &QFutureWatcherBase::finished, this, &MainWindow::applyEventFilterResult);
+
+    ui->actionRecordTrace->setChecked(Tracer::isEnabled());
+    connect(ui->actionRecordTrace, &QAction::toggled, this, [](bool enabled) { Tracer::setEnabled(enabled); });
+    connect(ui->actionExportTrace, &QAction::triggered, this, &MainWindow::exportTrace);
+
+    if (controller) {
+        setController(controller);
+    } else {
+        // Shown while the repositories load; nothing can be edited until setController()
+        ui->centralwidget->setEnabled(false);
+        m_loadingProgress = new QProgressBar(this);
+        m_loadingProgress->setRange(0, 0); // Busy indicator: loading reports no intermediate steps
+        m_loadingProgress->setMaximumWidth(200);
+        ui->statusbar->addPermanentWidget(m_loadingProgress);
+        ui->statusbar->showMessage("Loading volunteers and events...");
+    }
+}
+
+void MainWindow::setController(Controller* controller) {
+    TRACE_SCOPE("ui", "MainWindow::setController");
+    if (!controller) {
+        qWarning() << "MainWindow initialized with a null controller pointer!";
+        return;
+    }
+    if (m_controller) {
+        qWarning() << "MainWindow already has a controller.";
+        return;
+    }
+    m_controller = controller;
+    qDebug() << "MainWindow initialized with controller.";
+
+    // The models read rows lazily from the controller and follow its change signals
+    m_volunteerModel = new VolunteerListModel(m_controller, this);
+    m_eventModel = new EventListModel(m_controller, this);
+    m_eventMembersModel = new EventMembersModel(m_controller, this);
+    ui->volunteerListView->setModel(m_volunteerModel);
+    ui->eventListView->setModel(m_eventModel);
+    ui->volunteersInEventListView->setModel(m_eventMembersModel);
+    connect(ui->eventListView->selectionModel(), &QItemSelectionModel::currentChanged, this, &MainWindow::updateVolunteersInEventList);
+    connect(m_eventModel, &QAbstractItemModel::modelReset, this, &MainWindow::updateVolunteersInEventList); // A reset drops the current row silently
+
+    // Filter scans run on workers over published snapshots while edits go on here
+    m_controller->setSnapshotReads(true);
+
+    if (m_loadingProgress) {
+        ui->statusbar->removeWidget(m_loadingProgress);
+        m_loadingProgress->deleteLater();
+        m_loadingProgress = nullptr;
+    }
+    ui->statusbar->showMessage(QString("Loaded %1 volunteers and %2 events.")
+                                   .arg(m_controller->volunteerCount())
+                                   .arg(m_controller->eventCount()), 5000);
+    ui->centralwidget->setEnabled(true);
+}
+
+void MainWindow::paintEvent(QPaintEvent* event) {
+    QMainWindow::paintEvent(event);
+    if (!m_firstPaintReported) {
+        m_firstPaintReported = true;
+        emit firstPainted();
+    }
 }
 
 MainWindow::~MainWindow()
 {
+    if (m_filterCancelled) {
+        m_filterCancelled->store(true);
+    }
+    m_filterWatcher.waitForFinished();
     delete ui;
 }
 
 void MainWindow::addVolunteer() {
+    TRACE_SCOPE("ui", "MainWindow::addVolunteer");
     int id = ui->volunteerIdLineEdit->text().toInt();
     QString name = ui->volunteerNameLineEdit->text();
     QString contactInfo = ui->volunteerContactLineEdit->text();
@@ -53,26 +125,30 @@ void MainWindow::addVolunteer() {
         return;
     }
 
-    m_controller->addVolunteer(Volunteer(id, name, contactInfo));
-    populateVolunteerList();
+    if (ui->volunteerIdLineEdit->text().trimmed().isEmpty()) {
+        m_controller->addVolunteer(name, contactInfo); // Leave the ID blank to have one assigned
+    } else {
+        m_controller->addVolunteer(Volunteer(id, name, contactInfo));
+    }
     clearVolunteerInputFields();
 }
 
 void MainWindow::removeSelectedVolunteer() {
-    QListWidgetItem* selectedItem = ui->volunteerListWidget->currentItem();
-    if (selectedItem) {
-        int idToRemove = selectedItem->text().split(" - ").first().toInt();
+    TRACE_SCOPE("ui", "MainWindow::removeSelectedVolunteer");
+    QModelIndex selectedItem = ui->volunteerListView->currentIndex();
+    if (selectedItem.isValid()) {
+        int idToRemove = selectedItem.data(IdRole).toInt();
         m_controller->removeVolunteer(idToRemove);
-        populateVolunteerList();
     } else {
         QMessageBox::warning(this, "Remove Volunteer", "Please select a volunteer to remove.");
     }
 }
 
 void MainWindow::updateSelectedVolunteer() {
-    QListWidgetItem* selectedItem = ui->volunteerListWidget->currentItem();
-    if (selectedItem) {
-        int oldId = selectedItem->text().split(" - ").first().toInt();
+    TRACE_SCOPE("ui", "MainWindow::updateSelectedVolunteer");
+    QModelIndex selectedItem = ui->volunteerListView->currentIndex();
+    if (selectedItem.isValid()) {
+        int oldId = selectedItem.data(IdRole).toInt();
         int newId = ui->volunteerIdLineEdit->text().toInt();
         QString newName = ui->volunteerNameLineEdit->text();
         QString newContactInfo = ui->volunteerContactLineEdit->text();
@@ -83,7 +159,6 @@ void MainWindow::updateSelectedVolunteer() {
         }
 
         m_controller->updateVolunteer(oldId, Volunteer(newId, newName, newContactInfo));
-        populateVolunteerList();
         clearVolunteerInputFields();
     } else {
         QMessageBox::warning(this, "Update Volunteer", "Please select a volunteer to update.");
@@ -91,6 +166,7 @@ void MainWindow::updateSelectedVolunteer() {
 }
 
 void MainWindow::addEvent() {
+    TRACE_SCOPE("ui", "MainWindow::addEvent");
     int id = ui->eventIdLineEdit->text().toInt();
     QString title = ui->eventTitleLineEdit->text();
     QDate date = QDate::fromString(ui->eventDateLineEdit->text(), "yyyy-MM-dd");
@@ -101,27 +177,31 @@ void MainWindow::addEvent() {
         return;
     }
 
-    m_controller->addEvent(Event(id, title, date, location));
-    populateEventList();
+    if (ui->eventIdLineEdit->text().trimmed().isEmpty()) {
+        m_controller->addEvent(title, date, location); // Leave the ID blank to have one assigned
+    } else {
+        m_controller->addEvent(Event(id, title, date, location));
+    }
     clearEventInputFields();
 }
 
 void MainWindow::removeSelectedEvent()
 {
-    QListWidgetItem* selectedItem = ui->eventListWidget->currentItem();
-    if (selectedItem) {
-        int idToRemove = selectedItem->text().split(" - ").first().toInt();
+    TRACE_SCOPE("ui", "MainWindow::removeSelectedEvent");
+    QModelIndex selectedItem = ui->eventListView->currentIndex();
+    if (selectedItem.isValid()) {
+        int idToRemove = selectedItem.data(IdRole).toInt();
         m_controller->removeEvent(idToRemove);
-        populateEventList();
     } else {
         QMessageBox::warning(this, "Remove Event", "Please select an event to remove.");
     }
 }
 
 void MainWindow::updateSelectedEvent() {
-    QListWidgetItem* selectedItem = ui->eventListWidget->currentItem();
-    if (selectedItem) {
-        int oldId = selectedItem->text().split(" - ").first().toInt();
+    TRACE_SCOPE("ui", "MainWindow::updateSelectedEvent");
+    QModelIndex selectedItem = ui->eventListView->currentIndex();
+    if (selectedItem.isValid()) {
+        int oldId = selectedItem.data(IdRole).toInt();
         int newId = ui->eventIdLineEdit->text().toInt();
         QString newTitle = ui->eventTitleLineEdit->text();
         QDate newDate = QDate::fromString(ui->eventDateLineEdit->text(), "yyyy-MM-dd");
@@ -132,8 +212,17 @@ void MainWindow::updateSelectedEvent() {
             return;
         }
 
-        m_controller->updateEvent(oldId, Event(newId, newTitle, newDate, newLocation));
-        populateEventList();
+        const Event* current = m_controller->findEvent(oldId);
+        if (current && newId == oldId) {
+            // Same event: patch only the edited fields, which also keeps its volunteer assignments
+            EventFields changed;
+            changed.setFlag(EventField::Title, current->getTitle() != newTitle);
+            changed.setFlag(EventField::Date, current->getDate() != newDate);
+            changed.setFlag(EventField::Location, current->getLocation() != newLocation);
+            m_controller->updateEventFields(oldId, changed, {newTitle, newDate, newLocation, {}});
+        } else {
+            m_controller->updateEvent(oldId, Event(newId, newTitle, newDate, newLocation));
+        }
         clearEventInputFields();
     } else {
         QMessageBox::warning(this, "Update Event", "Please select an event to update.");
@@ -142,33 +231,27 @@ void MainWindow::updateSelectedEvent() {
 
 void MainWindow::undo()
 {
+    TRACE_SCOPE("ui", "MainWindow::undo");
     m_controller->undo();
-    populateVolunteerList();
-    populateEventList();
 }
 
 void MainWindow::redo()
 {
+    TRACE_SCOPE("ui", "MainWindow::redo");
     m_controller->redo();
-    populateVolunteerList();
-    populateEventList();
 }
 
-void MainWindow::populateVolunteerList()
+void MainWindow::exportTrace()
 {
-    ui->volunteerListWidget->clear();
-    std::vector<Volunteer> volunteers = m_controller->getAllVolunteers();
-    for (const auto& volunteer : volunteers) {
-        ui->volunteerListWidget->addItem(QString::number(volunteer.getId()) + " - " + volunteer.getName());
+    QString filename = QFileDialog::getSaveFileName(this, "Export Trace", "trace.json", "Chrome trace (*.json)");
+    if (filename.isEmpty()) {
+        return;
     }
-}
-
-void MainWindow::populateEventList()
-{
-    ui->eventListWidget->clear();
-    std::vector<Event> events = m_controller->getAllEvents();
-    for (const auto& event : events) {
-        ui->eventListWidget->addItem(QString::number(event.getId()) + " - " + event.getTitle() + " (" + event.getDate().toString("yyyy-MM-dd") + ")");
+    if (Tracer::exportChromeTrace(filename)) {
+        ui->statusbar->showMessage(QString("Exported %1 spans to %2. Open it in ui.perfetto.dev or chrome://tracing.")
+                                       .arg(Tracer::spanCount()).arg(filename), 5000);
+    } else {
+        QMessageBox::warning(this, "Export Trace", "The trace could not be written to " + filename + ".");
     }
 }
 
@@ -188,50 +271,25 @@ void MainWindow::clearEventInputFields()
 }
 
 void MainWindow::populateVolunteerInputFields() {
-    QListWidgetItem* selectedItem = ui->volunteerListWidget->currentItem();
-    if (selectedItem) {
-        QStringList parts = selectedItem->text().split(" - ");
-        if (parts.size() == 2) {
-            const int id = parts[0].toInt();
-            std::vector<Volunteer> volunteers = m_controller->getAllVolunteers();
-            for (const auto& volunteer : volunteers) {
-                if (volunteer.getId() == id) {
-                    ui->volunteerIdLineEdit->setText(QString::number(volunteer.getId()));
-                    ui->volunteerNameLineEdit->setText(volunteer.getName());
-                    ui->volunteerContactLineEdit->setText(volunteer.getContactInfo());
-                    return; // Exit after finding the volunteer
-                }
-            }
+    QModelIndex selectedItem = ui->volunteerListView->currentIndex();
+    if (selectedItem.isValid()) {
+        if (const Volunteer* volunteer = m_controller->findVolunteer(selectedItem.data(IdRole).toInt())) {
+            ui->volunteerIdLineEdit->setText(QString::number(volunteer->getId()));
+            ui->volunteerNameLineEdit->setText(volunteer->getName());
+            ui->volunteerContactLineEdit->setText(volunteer->getContactInfo());
         }
     } else {
         clearVolunteerInputFields();
     }
 }
 void MainWindow::populateEventInputFields() {
-    QListWidgetItem* selectedItem = ui->eventListWidget->currentItem();
-    if (selectedItem) {
-        QStringList parts = selectedItem->text().split(" - ");
-        if (parts.size() == 2) {
-            int id = parts[0].toInt();
-            QString titleAndDate = parts[1];
-            int openParenIndex = titleAndDate.indexOf("(");
-            int closeParenIndex = titleAndDate.indexOf(")");
-            if (openParenIndex != -1 && closeParenIndex != -1) {
-                QString title = titleAndDate.left(openParenIndex).trimmed();
-                QString dateString = titleAndDate.mid(openParenIndex + 1, closeParenIndex - openParenIndex - 1);
-                QDate date = QDate::fromString(dateString, "yyyy-MM-dd");
-
-                std::vector<Event> events = m_controller->getAllEvents();
-                for (const auto& event : events) {
-                    if (event.getId() == id) {
-                        ui->eventIdLineEdit->setText(QString::number(event.getId()));
-                        ui->eventTitleLineEdit->setText(event.getTitle());
-                        ui->eventDateLineEdit->setText(event.getDate().toString("yyyy-MM-dd"));
-                        ui->eventLocationLineEdit->setText(event.getLocation());
-                        return; // Exit after finding the event
-                    }
-                }
-            }
+    QModelIndex selectedItem = ui->eventListView->currentIndex();
+    if (selectedItem.isValid()) {
+        if (const Event* event = m_controller->findEvent(selectedItem.data(IdRole).toInt())) {
+            ui->eventIdLineEdit->setText(QString::number(event->getId()));
+            ui->eventTitleLineEdit->setText(event->getTitle());
+            ui->eventDateLineEdit->setText(event->getDate().toString("yyyy-MM-dd"));
+            ui->eventLocationLineEdit->setText(event->getLocation());
         }
     } else {
         clearEventInputFields();
@@ -239,99 +297,143 @@ void MainWindow::populateEventInputFields() {
 }
 
 void MainWindow::assignVolunteerToEvent() {
-    QListWidgetItem* selectedVolunteerItem = ui->volunteerListWidget->currentItem();
-    QListWidgetItem* selectedEventItem = ui->eventListWidget->currentItem();
+    TRACE_SCOPE("ui", "MainWindow::assignVolunteerToEvent");
+    QModelIndex selectedVolunteerItem = ui->volunteerListView->currentIndex();
+    QModelIndex selectedEventItem = ui->eventListView->currentIndex();
 
-    if (!selectedVolunteerItem || !selectedEventItem) {
+    if (!selectedVolunteerItem.isValid() || !selectedEventItem.isValid()) {
         QMessageBox::warning(this, "Assign Volunteer", "Please select a volunteer and an event.");
         return;
     }
 
-    int volunteerId = selectedVolunteerItem->text().split(" - ").first().toInt();
-    int eventId = selectedEventItem->text().split(" - ").first().toInt();
+    int volunteerId = selectedVolunteerItem.data(IdRole).toInt();
+    int eventId = selectedEventItem.data(IdRole).toInt();
 
-    m_controller->addVolunteerToEvent(volunteerId, eventId);
-    updateVolunteersInEventList(); // Refresh the list
+    if (!m_controller->addVolunteerToEvent(volunteerId, eventId)) {
+        QMessageBox::warning(this, "Assign Volunteer", "The volunteer could not be assigned. They may already be booked on another event that day.");
+        return;
+    }
 }
 
 void MainWindow::removeVolunteerFromEvent() {
-    QListWidgetItem* selectedVolunteerItem = ui->volunteersInEventListWidget->currentItem();
-    QListWidgetItem* selectedEventItem = ui->eventListWidget->currentItem();
+    TRACE_SCOPE("ui", "MainWindow::removeVolunteerFromEvent");
+    QModelIndex selectedVolunteerItem = ui->volunteersInEventListView->currentIndex();
+    QModelIndex selectedEventItem = ui->eventListView->currentIndex();
 
-    if (!selectedVolunteerItem || !selectedEventItem) {
+    if (!selectedVolunteerItem.isValid() || !selectedEventItem.isValid()) {
         QMessageBox::warning(this, "Remove Volunteer", "Please select a volunteer from the event's volunteer list.");
         return;
     }
 
-    if (!selectedEventItem) {
+    if (!selectedEventItem.isValid()) {
         QMessageBox::warning(this, "Remove Volunteer", "Please select an event.");
         return;
     }
 
-    int volunteerId = selectedVolunteerItem->text().split(" - ").first().toInt();
-    int eventId = selectedEventItem->text().split(" - ").first().toInt();
+    int volunteerId = selectedVolunteerItem.data(IdRole).toInt();
+    int eventId = selectedEventItem.data(IdRole).toInt();
 
     m_controller->removeVolunteerFromEvent(volunteerId, eventId);
-    updateVolunteersInEventList(); // Refresh the list
 }
 
 void MainWindow::updateVolunteersInEventList() {
-    ui->volunteersInEventListWidget->clear();
-    QListWidgetItem* selectedEventItem = ui->eventListWidget->currentItem();
-
-    if (selectedEventItem) {
-        int eventId = selectedEventItem->text().split(" - ").first().toInt();
-        std::vector<Event> events = m_controller->getAllEvents();
-        for (const auto& event : events) {
-            if (event.getId() == eventId) {
-                QList<int> volunteerIds = event.getVolunteerIds();
-                std::vector<Volunteer> volunteers = m_controller->getAllVolunteers();
-                for (const auto& volunteer : volunteers) {
-                    if (volunteerIds.contains(volunteer.getId())) {
-                        ui->volunteersInEventListWidget->addItem(QString::number(volunteer.getId()) + " - " + volunteer.getName());
-                    }
-                }
-                break; // Event found, exit loop
-            }
-        }
+    TRACE_SCOPE("ui", "MainWindow::updateVolunteersInEventList");
+    QModelIndex selectedEventItem = ui->eventListView->currentIndex();
+    if (selectedEventItem.isValid()) {
+        m_eventMembersModel->setEvent(selectedEventItem.data(IdRole).toInt());
+    } else {
+        m_eventMembersModel->setEvent(-1);
     }
 }
 
 void MainWindow::filterEventsByDate() {
     QString dateFilter = ui->eventDateFilterLineEdit->text();
-    qDebug() << "filterEventsByDate: dateFilter =" << dateFilter;
     QDate filterDate = QDate::fromString(dateFilter, "yyyy-MM-dd");
-    qDebug() << "filterEventsByDate: filterDate =" << filterDate;
 
     if (!filterDate.isValid() && !dateFilter.isEmpty()) {
         QMessageBox::warning(this, "Invalid Date", "Please enter the date in yyyy-MM-dd format.");
         return;
     }
 
-    std::vector<Event> filteredEvents = m_controller->filterEventsByDate(dateFilter);
-    qDebug() << "filterEventsByDate: filteredEvents.size() =" << filteredEvents.size();
-
-    ui->eventListWidget->clear();
-    int i = 0; // Add an index counter
-    for (const auto& event : filteredEvents) {
-        qDebug() << "  Event " << i++ << ": id=" << event.getId() << ", title=" << event.getTitle(); // Detailed event info
-        ui->eventListWidget->addItem(QString::number(event.getId()) + " - " + event.getTitle() + " (" + event.getDate().toString("yyyy-MM-dd") + ")");
-    }
-    qDebug() << "filterEventsByDate:  Finished loop"; // Add a final log
+    // The button skips the debounce delay
+    m_filterDebounce.stop();
+    runEventFilter();
 }
 
 void MainWindow::filterEventsByLocation() {
-    QString locationFilter = ui->eventLocationFilterLineEdit->text();
-    qDebug() << "filterEventsByLocation: locationFilter =" << locationFilter; // ADDED
+    m_filterDebounce.stop();
+    runEventFilter();
+}
 
-    std::vector<Event> filteredEvents = m_controller->filterEventsByLocation(locationFilter);
-    qDebug() << "filterEventsByLocation: filteredEvents.size() =" << filteredEvents.size(); // ADDED
+void MainWindow::runEventFilter() {
+    TRACE_SCOPE("ui", "MainWindow::runEventFilter");
+    if (!m_controller) {
+        return;
+    }
+    const QString dateFilter = ui->eventDateFilterLineEdit->text().trimmed();
+    const QString locationFilter = ui->eventLocationFilterLineEdit->text();
+    const QDate filterDate = QDate::fromString(dateFilter, "yyyy-MM-dd");
+    if (!dateFilter.isEmpty() && !filterDate.isValid()) {
+        return; // Date still being typed; keep the current results
+    }
 
-    ui->eventListWidget->clear();
-    int i = 0; // Add an index counter
-    for (const auto& event : filteredEvents) {
-        qDebug() << "  Event " << i++ << ": id=" << event.getId() << ", title=" << event.getTitle() << ", location=" << event.getLocation(); // Detailed event info
-        ui->eventListWidget->addItem(QString::number(event.getId()) + " - " + event.getTitle() + " (" + event.getDate().toString("yyyy-MM-dd") + " - " + event.getLocation() + ")");
+    if (m_filterCancelled) {
+        m_filterCancelled->store(true); // Supersede the scan in flight
+    }
+
+    if (dateFilter.isEmpty() && locationFilter.isEmpty()) {
+        m_eventModel->clearFilter(); // Back to the live list, without copying every event
+        return;
+    }
+
+    EventFilter filter;
+    filter.locationContains = locationFilter;
+    filter.from = filterDate; // Invalid (unrestricted) when no date is given
+    filter.to = filterDate;
+
+    m_filterShowLocation = !locationFilter.isEmpty();
+    // Repeating a query over unchanged events needs no scan at all
+    if (std::shared_ptr<const std::vector<int>> cached = m_controller->cachedEventIds(filter)) {
+        m_eventModel->setFilteredIds(std::vector<int>(*cached), m_filterShowLocation);
+        return;
+    }
+
+    // Taking the published version copies nothing; edits made during the scan leave it untouched
+    const std::shared_ptr<const ControllerSnapshot> published = m_controller->snapshot();
+    if (!published) {
+        return;
+    }
+    std::shared_ptr<const RepositorySnapshot<Event>> snapshot = published->events;
+    m_filterSnapshotGeneration = snapshot->generation();
+    auto cancelled = std::make_shared<std::atomic<bool>>(false);
+    m_filterCancelled = cancelled;
+    m_pendingFilter = filter;
+
+    m_filterWatcher.setFuture(QtConcurrent::run([snapshot, filter, cancelled]() {
+        return filterEventIds(*snapshot, filter, [cancelled]() { return cancelled->load(std::memory_order_relaxed); });
+    }));
+}
+
+void MainWindow::applyEventFilterResult() {
+    TRACE_SCOPE("ui", "MainWindow::applyEventFilterResult");
+    if (!m_filterWatcher.isFinished()) {
+        return; // A stale notification from a replaced future
+    }
+    if (m_filterCancelled && m_filterCancelled->load()) {
+        return; // Superseded after the scan returned, by a cleared filter or a cache hit
+    }
+    std::optional<std::vector<int>> ids = m_filterWatcher.result();
+    if (!ids) {
+        return; // Cancelled by a newer query
+    }
+    if (m_controller->eventGeneration() != m_filterSnapshotGeneration) {
+        // Events were added, removed or edited during the scan: its IDs may name deleted events and miss
+        // new matches, so scan the current version instead
+        runEventFilter();
+        return;
     }
-    qDebug() << "filterEventsByLocation: Finished loop"; // Add a final log
+    qDebug() << "Event filter matched" << ids->size() << "events.";
+    m_controller->cacheEventIds(m_pendingFilter, m_filterSnapshotGeneration, *ids);
+    // One reset swaps the whole result set in
+    m_eventModel->setFilteredIds(std::move(*ids), m_filterShowLocation);
 }
@@ -2,8 +2,19 @@
 #define MAINWINDOW_H
 
 #include <QMainWindow>
+#include <QTimer>
+#include <QFutureWatcher>
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <vector>
 #include "../Controller/Controller.h"
 
+class QProgressBar;
+class VolunteerListModel;
+class EventListModel;
+class EventMembersModel;
+
 QT_BEGIN_NAMESPACE
 namespace Ui { class MainWindow; }
 QT_END_NAMESPACE
@@ -15,9 +26,19 @@ class MainWindow : public QMainWindow
     Q_OBJECT
 
 public:
-    MainWindow(Controller* controller, QWidget *parent = nullptr);
+    // Without a controller the window starts disabled with a loading indicator
+    MainWindow(Controller* controller = nullptr, QWidget *parent = nullptr);
     ~MainWindow();
 
+    // Attaches the controller once the repositories are loaded and enables editing
+    void setController(Controller* controller);
+
+signals:
+    void firstPainted();
+
+protected:
+    void paintEvent(QPaintEvent* event) override;
+
 private slots:
     void addVolunteer();
     void removeSelectedVolunteer();
@@ -36,13 +57,30 @@ private slots:
 
     void filterEventsByDate();
     void filterEventsByLocation();
+    void runEventFilter();
+    void applyEventFilterResult();
+
+    void exportTrace();
 
 private:
     Ui::MainWindow *ui;
     Controller* m_controller;
+    VolunteerListModel* m_volunteerModel;
+    EventListModel* m_eventModel;
+    EventMembersModel* m_eventMembersModel;
+
+    // Filter-as-you-type: keystrokes restart the debounce timer, the scan runs on a worker
+    // thread over the controller's published snapshot, and a newer query cancels the one in flight.
+    QTimer m_filterDebounce;
+    QFutureWatcher<std::optional<std::vector<int>>> m_filterWatcher;
+    std::shared_ptr<std::atomic<bool>> m_filterCancelled;
+    std::uint64_t m_filterSnapshotGeneration = 0;
+    EventFilter m_pendingFilter; // The query the watched scan answers, cached when it finishes
+    bool m_filterShowLocation = false;
+
+    QProgressBar* m_loadingProgress = nullptr;
+    bool m_firstPaintReported = false;
 
-    void populateVolunteerList();
-    void populateEventList();
     void clearVolunteerInputFields();
     void clearEventInputFields();
 };